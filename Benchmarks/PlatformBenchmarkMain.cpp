@@ -0,0 +1,78 @@
+// Command line driver for the platform layer benchmarks so CI can run them and keep the JSON.
+//
+//   PlatformBenchmark --work-dir <dir> [--output <file.json>] [--makefile-iterations N] [--load-iterations N]
+//                     [--upload-iterations N] [--extract-iterations N] [--port N]
+//
+// The JSON goes to stdout unless --output is given. Returns 0 when every benchmark passed.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Util/CommonDefs.h"
+#include "Build/PlatformRpi4.h"
+#include "Benchmarks/PlatformRpi4Benchmark.h"
+
+using namespace platform;
+
+static void printUsage(const char* programName)
+{
+    fprintf(stderr, "usage: %s --work-dir <dir> [--output <file.json>] [--makefile-iterations N] [--load-iterations N]\n"
+                    "       [--upload-iterations N] [--extract-iterations N] [--port N]\n", programName);
+}
+
+static bool parseUnsigned(const char* text, unsigned& value)
+{
+    char* end = nullptr;
+    unsigned long parsed = std::strtoul(text, &end, 10);
+    if ((end == text) || (*end != '\0') || (parsed > 0xffffffffUL)) { return false; }
+    value = static_cast<unsigned>(parsed);
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    PlatformBenchmarkOptions options;
+    std::string outputPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((i + 1 >= argc) || (arg.compare(0, 2, "--") != 0)) { printUsage(argv[0]); return 2; }
+        const char* value = argv[++i];
+
+        bool valid = true;
+        if      (arg == "--work-dir")            { options.workDirectory = value; }
+        else if (arg == "--output")              { outputPath = value; }
+        else if (arg == "--makefile-iterations") { valid = parseUnsigned(value, options.makefileIterations); }
+        else if (arg == "--load-iterations")     { valid = parseUnsigned(value, options.loadIterations); }
+        else if (arg == "--upload-iterations")   { valid = parseUnsigned(value, options.uploadIterations); }
+        else if (arg == "--extract-iterations")  { valid = parseUnsigned(value, options.extractIterations); }
+        else if (arg == "--port")                { valid = parseUnsigned(value, options.receiverPort); }
+        else { valid = false; }
+
+        if (!valid) {
+            fprintf(stderr, "invalid argument: %s %s\n", arg.c_str(), value);
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (options.workDirectory.empty()) { printUsage(argv[0]); return 2; }
+
+    PlatformRpi4b platform(PlatformEnum::RPI4B);
+    std::string jsonResults;
+    int ret = runPlatformBenchmarks(platform, options, jsonResults);
+    if (jsonResults.empty()) {
+        fprintf(stderr, "benchmarks did not run\n");
+        return 1;
+    }
+
+    if (outputPath.empty()) {
+        std::cout << jsonResults;
+    } else {
+        std::ofstream outputFile(outputPath, std::ios::trunc);
+        outputFile << jsonResults;
+        if (!outputFile) { fprintf(stderr, "unable to write %s\n", outputPath.c_str()); return 1; }
+    }
+    return (ret == SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(LINUX) || defined(MACOS)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include "Util/FileUtil.h"
+#include "Util/ErrorMessage.h"
+#include "Util/CommonDefs.h"
+#include "Benchmarks/PlatformRpi4Benchmark.h"
+
+using namespace stride;
+
+namespace platform {
+
+struct BenchmarkResult {
+    std::string name;
+    unsigned iterations = 0;
+    size_t   bytes = 0;         // bytes processed per iteration, 0 if not applicable
+    double   minUs = 0.0;
+    double   medianUs = 0.0;
+    double   meanUs = 0.0;
+    double   maxUs = 0.0;
+    bool     passed = true;
+};
+
+static BenchmarkResult timeOperation(const std::string& name, unsigned iterations, size_t bytes, std::function<int(unsigned)> operation)
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.bytes = bytes;
+
+    std::vector<double> timesUs;
+    for (unsigned i = 0; i < iterations; i++) {
+        auto startTime = std::chrono::steady_clock::now();
+        int ret = operation(i);
+        auto endTime = std::chrono::steady_clock::now();
+        if (ret != SUCCESS) { result.passed = false; break; }
+        timesUs.push_back(std::chrono::duration<double, std::micro>(endTime - startTime).count());
+    }
+    if (timesUs.empty()) { return result; }
+
+    std::sort(timesUs.begin(), timesUs.end());
+    result.iterations = static_cast<unsigned>(timesUs.size());
+    result.minUs    = timesUs.front();
+    result.maxUs    = timesUs.back();
+    result.medianUs = timesUs[timesUs.size() / 2];
+    double totalUs = 0.0;
+    for (auto timeUs : timesUs) { totalUs += timeUs; }
+    result.meanUs = totalUs / timesUs.size();
+    return result;
+}
+
+static std::string toJson(const std::vector<BenchmarkResult>& results)
+{
+    std::ostringstream json;
+    json << "{\n  \"platform\": \"RPI4B\",\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        json << "    { \"name\": \"" << result.name << "\""
+             << ", \"passed\": " << (result.passed ? "true" : "false")
+             << ", \"iterations\": " << result.iterations
+             << ", \"bytes\": " << result.bytes
+             << ", \"min_us\": " << result.minUs
+             << ", \"median_us\": " << result.medianUs
+             << ", \"mean_us\": " << result.meanUs
+             << ", \"max_us\": " << result.maxUs;
+        if ((result.bytes > 0) && (result.medianUs > 0.0)) {
+            json << ", \"median_mib_per_s\": " << (result.bytes / (1024.0 * 1024.0)) / (result.medianUs / 1.0e6);
+        }
+        json << " }" << ((i + 1 < results.size()) ? "," : "") << "\n";
+    }
+    json << "  ]\n}\n";
+    return json.str();
+}
+
+int generateSyntheticImage(const std::string& filePath, size_t sizeBytes, uint32_t seed)
+{
+    std::ofstream imageFile(filePath, std::ios::binary | std::ios::trunc);
+    if (!imageFile) { errorMessage("generateSyntheticImage(): unable to create " + filePath); return FAILURE; }
+
+    // xorshift32 so the same seed always gives the same image
+    uint32_t state = seed ? seed : 0x12345678;
+    std::vector<char> buffer(64 * 1024);
+    size_t bytesRemaining = sizeBytes;
+    while (bytesRemaining > 0) {
+        size_t chunkSize = std::min(bytesRemaining, buffer.size());
+        for (size_t i = 0; i < chunkSize; i++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            buffer[i] = static_cast<char>(state);
+        }
+        imageFile.write(buffer.data(), chunkSize);
+        bytesRemaining -= chunkSize;
+    }
+    return imageFile ? SUCCESS : FAILURE;
+}
+
+#if defined(LINUX) || defined(MACOS)
+// Minimal TFTP write receiver standing in for the device. It accepts one transfer and discards the data.
+class LocalTftpReceiver {
+public:
+    LocalTftpReceiver(unsigned port) : m_port(port) {}
+    ~LocalTftpReceiver() { stop(); }
+
+    int start() {
+        m_socket = socket(AF_INET, SOCK_DGRAM, 0);
+        if (m_socket < 0) { return FAILURE; }
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(m_port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(m_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0) {
+            close(m_socket); m_socket = -1;
+            return FAILURE;
+        }
+        setReceiveTimeout(m_socket, 5);
+        m_bytesReceived = 0;
+        m_thread = std::thread([this]() { receive(); });
+        return SUCCESS;
+    }
+
+    void stop() {
+        if (m_thread.joinable()) { m_thread.join(); }
+        if (m_socket >= 0) { close(m_socket); m_socket = -1; }
+    }
+
+    size_t getBytesReceived() const { return m_bytesReceived; }
+
+private:
+    static void setReceiveTimeout(int sock, int seconds) {
+        struct timeval timeout = {};
+        timeout.tv_sec = seconds;
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    void receive() {
+        constexpr size_t TFTP_BLOCK_SIZE = 512;
+        constexpr uint8_t OP_WRQ = 2, OP_DATA = 3, OP_ACK = 4;
+        uint8_t packet[4 + TFTP_BLOCK_SIZE];
+        struct sockaddr_in client = {};
+        socklen_t clientLen = sizeof(client);
+
+        ssize_t packetSize = recvfrom(m_socket, packet, sizeof(packet), 0, reinterpret_cast<struct sockaddr*>(&client), &clientLen);
+        if ((packetSize < 4) || (packet[1] != OP_WRQ)) { return; }
+
+        // The transfer continues on a new port, as per RFC 1350
+        int transferSocket = socket(AF_INET, SOCK_DGRAM, 0);
+        if (transferSocket < 0) { return; }
+        setReceiveTimeout(transferSocket, 5);
+
+        auto sendAck = [&](uint16_t block) {
+            uint8_t ack[4] = { 0, OP_ACK, static_cast<uint8_t>(block >> 8), static_cast<uint8_t>(block) };
+            sendto(transferSocket, ack, sizeof(ack), 0, reinterpret_cast<struct sockaddr*>(&client), clientLen);
+        };
+
+        uint16_t lastBlock = 0;
+        sendAck(lastBlock);
+        while (true) {
+            packetSize = recv(transferSocket, packet, sizeof(packet), 0);
+            if ((packetSize < 4) || (packet[1] != OP_DATA)) { break; }
+            uint16_t block = static_cast<uint16_t>((packet[2] << 8) | packet[3]);
+            if (block == static_cast<uint16_t>(lastBlock + 1)) { // block numbers roll over on large images
+                m_bytesReceived += static_cast<size_t>(packetSize) - 4;
+                lastBlock = block;
+            }
+            sendAck(block);
+            if ((block == lastBlock) && (static_cast<size_t>(packetSize) - 4 < TFTP_BLOCK_SIZE)) { break; }
+        }
+        close(transferSocket);
+    }
+
+    unsigned m_port;
+    int m_socket = -1;
+    std::thread m_thread;
+    std::atomic<size_t> m_bytesReceived {0};
+};
+#endif
+
+// Restores the programming address the caller had set however the benchmarks return
+class ProgrammingAddressGuard {
+public:
+    ProgrammingAddressGuard(PlatformRpi4b& platform)
+        : m_platform(platform), m_ipAddress(platform.getProgrammingAddress()), m_port(platform.getProgrammingPort()) {}
+    ~ProgrammingAddressGuard() { m_platform.setProgrammingAddress(m_ipAddress, m_port); }
+private:
+    PlatformRpi4b& m_platform;
+    std::string m_ipAddress;
+    unsigned m_port;
+};
+
+int runPlatformBenchmarks(PlatformRpi4b& platform, const PlatformBenchmarkOptions& options, std::string& jsonResults)
+{
+    if (options.workDirectory.empty()) { errorMessage("runPlatformBenchmarks(): workDirectory is empty"); return FAILURE; }
+    if (!FileUtil::directoryExists(options.workDirectory) && (FileUtil::createDirectory(options.workDirectory) != SUCCESS)) {
+        errorMessage("runPlatformBenchmarks(): unable to create " + options.workDirectory);
+        return FAILURE;
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    // Tool extraction, each iteration extracts into an empty directory
+    if (options.extractIterations > 0) {
+        results.push_back(timeOperation("unzipBuildTools", options.extractIterations, 0, [&](unsigned iteration) {
+            std::string toolsDirectory = options.workDirectory + "/tools" + std::to_string(iteration);
+            FileUtil::deleteDirectory(toolsDirectory);
+            int ret = platform.unzipBuildTools(toolsDirectory);
+            FileUtil::deleteDirectory(toolsDirectory);
+            return ret;
+        }));
+    }
+
+    // Makefile generation
+    Flags flags{};
+    const std::string cppFlags = "-DBENCHMARK_FLAG_A -DBENCHMARK_FLAG_B";
+    results.push_back(timeOperation("getEfxMakefileInc", options.makefileIterations, 0, [&](unsigned) {
+        return platform.getEfxMakefileInc(flags, cppFlags).empty() ? FAILURE : SUCCESS;
+    }));
+
+    std::vector<std::string> includeDirectoriesVec;
+    for (unsigned i = 0; i < 16; i++) { includeDirectoriesVec.push_back(options.workDirectory + "/include/lib" + std::to_string(i)); }
+    results.push_back(timeOperation("createTestMakefile", options.makefileIterations, 0, [&](unsigned) {
+        std::string makefile = platform.createTestMakefile(options.workDirectory + "/tools", options.workDirectory + "/libs",
+            "Effect.STRIDE-MKII.dat", "testApp", "irData", includeDirectoriesVec);
+        return makefile.empty() ? FAILURE : SUCCESS;
+    }));
+
+    // Image loading and upload across image sizes up to the flash limit
+    std::vector<size_t> imageSizes = { 64 * 1024, 1024 * 1024, 8 * 1024 * 1024, platform.getFlashMaxSize() };
+    ProgrammingAddressGuard addressGuard(platform);
+    for (auto imageSize : imageSizes) {
+        std::string imageDirectory = options.workDirectory + "/image" + std::to_string(imageSize);
+        std::string imagePath = imageDirectory + "/kernel84.img"; // programDevice() uploads kernel84.img from the image folder
+        // Record the failure and carry on with the other sizes so the results collected so far are kept
+        if ((!FileUtil::directoryExists(imageDirectory) && (FileUtil::createDirectory(imageDirectory) != SUCCESS)) ||
+            (generateSyntheticImage(imagePath, imageSize, static_cast<uint32_t>(imageSize)) != SUCCESS)) {
+            errorMessage("runPlatformBenchmarks(): unable to create the " + std::to_string(imageSize) + " byte image in " + imageDirectory);
+            BenchmarkResult failedResult;
+            failedResult.name   = "generateSyntheticImage/" + std::to_string(imageSize);
+            failedResult.bytes  = imageSize;
+            failedResult.passed = false;
+            results.push_back(failedResult);
+            continue;
+        }
+
+        results.push_back(timeOperation("loadBinaryFile/" + std::to_string(imageSize), options.loadIterations, imageSize, [&](unsigned) {
+            return (platform.loadBinaryFile(imagePath) == static_cast<int>(imageSize)) ? SUCCESS : FAILURE;
+        }));
+
+#if defined(LINUX) || defined(MACOS)
+        if ((options.receiverPort > 0) && (options.uploadIterations > 0)) {
+            platform.setProgrammingAddress("127.0.0.1", options.receiverPort);
+            results.push_back(timeOperation("programDevice/" + std::to_string(imageSize), options.uploadIterations, imageSize, [&](unsigned) {
+                LocalTftpReceiver receiver(options.receiverPort);
+                if (receiver.start() != SUCCESS) { errorMessage("runPlatformBenchmarks(): unable to start local receiver"); return FAILURE; }
+                int ret = platform.programDevice();
+                receiver.stop();
+                if (receiver.getBytesReceived() != imageSize) { return FAILURE; }
+                return ret;
+            }));
+        }
+#endif
+    }
+
+    jsonResults = toJson(results);
+
+    bool allPassed = true;
+    for (auto& result : results) { allPassed = allPassed && result.passed; }
+    return allPassed ? SUCCESS : FAILURE;
+}
+
+}
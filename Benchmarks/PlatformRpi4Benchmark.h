@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Build/PlatformRpi4.h"
+
+namespace platform {
+
+struct PlatformBenchmarkOptions {
+    std::string workDirectory;             // scratch directory for extracted tools, images and makefiles
+    unsigned makefileIterations  = 1000;
+    unsigned loadIterations      = 20;
+    unsigned uploadIterations    = 3;
+    unsigned extractIterations   = 1;      // 0 to skip, extracting the toolchain is slow
+    unsigned receiverPort        = 6969;   // local TFTP receiver for the upload benchmark, 0 to skip
+};
+
+// Write a repeatable pseudo-random image of sizeBytes for the load and upload benchmarks
+int generateSyntheticImage(const std::string& filePath, size_t sizeBytes, uint32_t seed);
+
+// Time the platform layer operations (tool extraction, makefile generation, image loading and
+// upload to a local receiver) and return the results as JSON for tracking regressions in CI.
+int runPlatformBenchmarks(PlatformRpi4b& platform, const PlatformBenchmarkOptions& options, std::string& jsonResults);
+
+}
@@ -0,0 +1,348 @@
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#if defined(LINUX) || defined(MACOS)
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "Util/CommonDefs.h"
+#include "Util/ErrorMessage.h"
+#include "Build/LaunchProcess.h"
+#include "Build/LaunchProcessStream.h"
+
+namespace stride {
+
+// Digit runs too long for an int are still treated as a number but reported as 0 (unknown)
+static bool parseNumber(const std::string& text, int& value)
+{
+    constexpr size_t MAX_DIGITS = 9;
+    if (text.empty() || (text.find_first_not_of("0123456789") != std::string::npos)) { return false; }
+    value = (text.size() <= MAX_DIGITS) ? std::atoi(text.c_str()) : 0;
+    return true;
+}
+
+static bool endsWith(const std::string& text, const std::string& suffix)
+{
+    return (text.size() >= suffix.size()) && (text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+// ld, aarch64-none-elf-ld, /path/to/g++, C:/path/to/collect2.exe, etc.
+static bool isToolName(const std::string& name)
+{
+    static const char* TOOL_NAMES[] = { "ld", "as", "ar", "cc1", "cc1plus", "collect2", "gcc", "g++" };
+    bool hasDriveLetter = (name.size() > 2) && std::isalpha(static_cast<unsigned char>(name[0])) && (name[1] == ':');
+    if (name.empty() || (name.find_first_of(" \t:", hasDriveLetter ? 2 : 0) != std::string::npos)) { return false; }
+    std::string baseName = name;
+    if (endsWith(baseName, ".exe")) { baseName.resize(baseName.size() - 4); }
+    size_t separator = baseName.find_last_of("-/\\");
+    if (separator != std::string::npos) { baseName = baseName.substr(separator + 1); }
+    for (auto toolName : TOOL_NAMES) {
+        if (baseName == toolName) { return true; }
+    }
+    return false;
+}
+
+// make, gmake.exe, mingw32-make.exe, /usr/bin/make, make[2], etc.
+static bool isMakeName(const std::string& name)
+{
+    if (name.empty() || (name.find_first_of(" \t:") != std::string::npos)) { return false; }
+    std::string baseName = name;
+    size_t separator = baseName.find_last_of("-/\\");
+    if (separator != std::string::npos) { baseName = baseName.substr(separator + 1); }
+    size_t bracket = baseName.find('[');
+    if ((bracket != std::string::npos) && endsWith(baseName, "]")) {
+        int level = 0;
+        if (!parseNumber(baseName.substr(bracket + 1, baseName.size() - bracket - 2), level)) { return false; }
+        baseName.resize(bracket);
+    }
+    if (endsWith(baseName, ".exe")) { baseName.resize(baseName.size() - 4); }
+    return (baseName == "make") || (baseName == "gmake");
+}
+
+// Tools print progress (ar: creating ...) and context (ld: file.o: in function `foo':) the same way they
+// print failures, so a tool-prefixed line without a severity marker is only an error in these forms.
+static bool isFatalToolMessage(const std::string& message)
+{
+    static const char* FATAL_FORMS[] = {
+        "cannot find", "cannot open", "no such file", "file format not recognized", "file not recognized",
+        "undefined reference", "multiple definition", "relocation truncated", "will not fit in region",
+        "overflowed by", "overlaps section", "unrecognized option", "unrecognised option", "returned 1 exit status"
+    };
+    std::string lowerMessage = message;
+    for (auto& c : lowerMessage) { c = static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }
+    for (auto fatalForm : FATAL_FORMS) {
+        if (lowerMessage.find(fatalForm) != std::string::npos) { return true; }
+    }
+    return false;
+}
+
+static size_t skipSpaces(const std::string& text, size_t pos)
+{
+    while ((pos < text.size()) && ((text[pos] == ' ') || (text[pos] == '\t'))) { pos++; }
+    return pos;
+}
+
+// Build output lines can be very long (e.g. a full compiler command line), so they are scanned by hand
+// rather than with std::regex, which recurses per character in libstdc++ and can overflow the stack.
+bool parseBuildDiagnostic(const std::string& line, BuildDiagnostic& diagnostic)
+{
+    diagnostic = BuildDiagnostic();
+
+    // make: *** [Makefile:12: obj/file.o] Error 1
+    size_t makePos = line.find(": *** ");
+    if ((makePos != std::string::npos) && isMakeName(line.substr(0, makePos))) {
+        diagnostic.severity = DiagnosticSeverity::DIAG_ERROR;
+        diagnostic.tool     = line.substr(0, makePos);
+        diagnostic.message  = line.substr(makePos + 6);
+        return true;
+    }
+
+    // file.cpp:12:5: error: message, or collect2: error: ld returned 1 exit status, the assembler capitalizes them
+    static const std::pair<const char*, DiagnosticSeverity> SEVERITY_MARKERS[] = {
+        { ": fatal error:", DiagnosticSeverity::DIAG_ERROR },
+        { ": error:",       DiagnosticSeverity::DIAG_ERROR },
+        { ": Error:",       DiagnosticSeverity::DIAG_ERROR },
+        { ": warning:",     DiagnosticSeverity::DIAG_WARNING },
+        { ": Warning:",     DiagnosticSeverity::DIAG_WARNING },
+        { ": note:",        DiagnosticSeverity::DIAG_NOTE }
+    };
+    size_t markerPos = std::string::npos;
+    size_t markerLength = 0;
+    for (auto& marker : SEVERITY_MARKERS) {
+        size_t pos = line.find(marker.first);
+        if (pos < markerPos) {
+            markerPos    = pos;
+            markerLength = std::strlen(marker.first);
+            diagnostic.severity = marker.second;
+        }
+    }
+    if ((markerPos != std::string::npos) && (markerPos > 0)) {
+        std::string prefix  = line.substr(0, markerPos);
+        std::string message = line.substr(skipSpaces(line, markerPos + markerLength));
+
+        // Split the line and column numbers off the right so Windows drive letters stay in the file name
+        int numbers[2] = {0, 0};
+        unsigned numberCount = 0;
+        std::string location = prefix;
+        while (numberCount < 2) {
+            size_t colon = location.rfind(':');
+            if ((colon == std::string::npos) || (colon == 0)) { break; }
+            int number = 0;
+            if (!parseNumber(location.substr(colon + 1), number)) { break; }
+            numbers[numberCount++] = number;
+            location.resize(colon);
+        }
+
+        if (numberCount > 0) {
+            diagnostic.file    = location;
+            diagnostic.line    = numbers[numberCount - 1];
+            diagnostic.column  = (numberCount == 2) ? numbers[0] : 0;
+            diagnostic.message = message;
+            return true;
+        }
+        if (isToolName(prefix)) {
+            diagnostic.tool    = prefix;
+            diagnostic.message = message;
+            return true;
+        }
+        if (prefix.find(':') == std::string::npos) {
+            diagnostic.file    = prefix; // file.o: warning: ... with no line information
+            diagnostic.message = message;
+            return true;
+        }
+    }
+
+    // aarch64-none-elf-ld: cannot find -lfoo, or aarch64-none-elf-gcc-ar: creating obj/x.dat
+    size_t toolPos = line.find(": ");
+    if ((toolPos != std::string::npos) && isToolName(line.substr(0, toolPos))) {
+        diagnostic.tool    = line.substr(0, toolPos);
+        diagnostic.message = line.substr(skipSpaces(line, toolPos + 2));
+        diagnostic.severity = isFatalToolMessage(diagnostic.message) ? DiagnosticSeverity::DIAG_ERROR : DiagnosticSeverity::DIAG_NOTE;
+        return true;
+    }
+
+    // file.o:(.text+0x10): undefined reference to `symbol'
+    size_t sectionPos = line.find(":(");
+    size_t sectionEnd = (sectionPos != std::string::npos) ? line.find("):", sectionPos) : std::string::npos;
+    if ((sectionPos != std::string::npos) && (sectionPos > 0) && (sectionEnd != std::string::npos)) {
+        std::string message = line.substr(skipSpaces(line, sectionEnd + 2));
+        if ((message.find("undefined reference") != std::string::npos) ||
+            (message.find("multiple definition") != std::string::npos) ||
+            (message.find("relocation truncated") != std::string::npos)) {
+            diagnostic.severity = DiagnosticSeverity::DIAG_ERROR;
+            diagnostic.file     = line.substr(0, sectionPos);
+            diagnostic.message  = message;
+            return true;
+        }
+    }
+
+    diagnostic = BuildDiagnostic();
+    return false;
+}
+
+#if defined(LINUX) || defined(MACOS)
+
+int LaunchProcessStreaming(const std::string& command, const std::string& workingDirectory,
+    ProcessLineCallback lineCallback, DiagnosticCallback diagnosticCallback,
+    bool abortOnFirstError, unsigned timeoutSeconds,
+    const std::atomic<bool>* cancelRequest, std::string* output,
+    ProcessStreamStatus* status)
+{
+    constexpr int POLL_PERIOD_MS   = 100;
+    constexpr int KILL_GRACE_MS    = 2000;
+    constexpr size_t READ_BUF_SIZE = 4096;
+
+    int pipeFds[2];
+    if (pipe(pipeFds) != 0) { errorMessage("LaunchProcessStreaming(): unable to create pipe"); return FAILURE; }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        errorMessage("LaunchProcessStreaming(): unable to fork process");
+        return FAILURE;
+    }
+
+    if (pid == 0) {
+        // Child runs in its own process group so the whole job tree can be stopped at once
+        setpgid(0, 0);
+        dup2(pipeFds[1], STDOUT_FILENO);
+        dup2(pipeFds[1], STDERR_FILENO);
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        if (!workingDirectory.empty() && (chdir(workingDirectory.c_str()) != 0)) { _exit(127); }
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    setpgid(pid, pid); // also set from the parent to avoid racing the child
+    close(pipeFds[1]);
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto killTime  = startTime;
+    bool killed = false;
+    bool timedOut = false;
+    bool cancelled = false;
+    bool errorFound = false;
+    std::string pending;
+    char readBuf[READ_BUF_SIZE];
+
+    auto stopJobTree = [&](int sig) {
+        killpg(pid, sig);
+        if (!killed) { killTime = std::chrono::steady_clock::now(); }
+        killed = true;
+    };
+
+    auto processLine = [&](const std::string& line) {
+        if (output) { *output += line + "\n"; }
+        if (killed) { return; } // don't report the fallout from stopping the jobs
+        if (lineCallback) { lineCallback(line); }
+
+        BuildDiagnostic diagnostic;
+        if (!parseBuildDiagnostic(line, diagnostic)) { return; }
+        if (diagnosticCallback) { diagnosticCallback(diagnostic); }
+        if (diagnostic.severity == DiagnosticSeverity::DIAG_ERROR) {
+            errorFound = true;
+            if (abortOnFirstError) { stopJobTree(SIGTERM); }
+        }
+    };
+
+    while (true) {
+        struct pollfd pollFd = { pipeFds[0], POLLIN, 0 };
+        int ready = poll(&pollFd, 1, POLL_PERIOD_MS);
+        if (ready > 0) {
+            ssize_t bytesRead = read(pipeFds[0], readBuf, sizeof(readBuf));
+            if (bytesRead <= 0) { break; } // EOF, all writers have exited
+
+            pending.append(readBuf, static_cast<size_t>(bytesRead));
+            size_t newlinePos;
+            while ((newlinePos = pending.find('\n')) != std::string::npos) {
+                std::string line = pending.substr(0, newlinePos);
+                if (!line.empty() && (line.back() == '\r')) { line.pop_back(); }
+                pending.erase(0, newlinePos + 1);
+                processLine(line);
+            }
+        } else if ((ready < 0) && (errno != EINTR)) {
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (!killed) {
+            timedOut  = (timeoutSeconds > 0) && (now - startTime >= std::chrono::seconds(timeoutSeconds));
+            cancelled = cancelRequest && cancelRequest->load();
+            if (timedOut || cancelled) { stopJobTree(SIGTERM); }
+        } else if (now - killTime >= std::chrono::milliseconds(KILL_GRACE_MS)) {
+            // a job ignored SIGTERM or is holding the pipe open, stop waiting on it
+            killpg(pid, SIGKILL);
+            break;
+        }
+    }
+    if (!pending.empty()) { processLine(pending); }
+    close(pipeFds[0]);
+
+    int waitStatus = 0;
+    while ((waitpid(pid, &waitStatus, 0) < 0) && (errno == EINTR)) {}
+
+    int exitCode = WIFEXITED(waitStatus) ? WEXITSTATUS(waitStatus) : -1;
+    if (status) {
+        status->exitCode   = exitCode;
+        status->timedOut   = timedOut;
+        status->cancelled  = cancelled;
+        status->errorFound = errorFound;
+    }
+    return ((exitCode == 0) && !errorFound && !timedOut && !cancelled) ? SUCCESS : FAILURE;
+}
+
+#elif defined(WINDOWS)
+
+int LaunchProcessStreaming(const std::string& command, const std::string& workingDirectory,
+    ProcessLineCallback lineCallback, DiagnosticCallback diagnosticCallback,
+    bool abortOnFirstError, unsigned timeoutSeconds,
+    const std::atomic<bool>* cancelRequest, std::string* output,
+    ProcessStreamStatus* status)
+{
+    // No process group support yet, run to completion and then report the output line by line
+    (void)cancelRequest;
+    std::string result;
+    int ret = LaunchProcessCommand(command, result, workingDirectory, timeoutSeconds);
+    if (output) { *output = result; }
+
+    bool errorFound = false;
+    size_t startPos = 0;
+    while (startPos < result.size()) {
+        size_t newlinePos = result.find('\n', startPos);
+        if (newlinePos == std::string::npos) { newlinePos = result.size(); }
+        std::string line = result.substr(startPos, newlinePos - startPos);
+        if (!line.empty() && (line.back() == '\r')) { line.pop_back(); }
+        startPos = newlinePos + 1;
+
+        if (lineCallback) { lineCallback(line); }
+        BuildDiagnostic diagnostic;
+        if (parseBuildDiagnostic(line, diagnostic)) {
+            if (diagnosticCallback) { diagnosticCallback(diagnostic); }
+            if (diagnostic.severity == DiagnosticSeverity::DIAG_ERROR) {
+                errorFound = true;
+                if (abortOnFirstError) { break; }
+            }
+        }
+    }
+    if (status) {
+        // LaunchProcessCommand() only reports pass/fail, a timeout shows up as a failure
+        status->exitCode   = (ret == SUCCESS) ? 0 : -1;
+        status->errorFound = errorFound;
+    }
+    return ((ret == SUCCESS) && !errorFound) ? SUCCESS : FAILURE;
+}
+
+#else
+#error Unsupported OS in LaunchProcessStream.cpp
+#endif
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace stride {
+
+enum class DiagnosticSeverity {
+    DIAG_NOTE,
+    DIAG_WARNING,
+    DIAG_ERROR
+};
+
+// A single compiler, assembler, linker or make diagnostic parsed from the process output
+struct BuildDiagnostic {
+    DiagnosticSeverity severity = DiagnosticSeverity::DIAG_NOTE;
+    std::string tool;     // set when the line comes from a tool rather than a source file (e.g. ld, make)
+    std::string file;
+    int line   = 0;
+    int column = 0;
+    std::string message;
+};
+
+// How a streamed process ended, so callers can report why it failed
+struct ProcessStreamStatus {
+    int  exitCode   = -1;    // -1 if the process did not exit normally, e.g. it was stopped by a signal
+    bool timedOut   = false;
+    bool cancelled  = false;
+    bool errorFound = false; // an error diagnostic was parsed from the output
+};
+
+using ProcessLineCallback = std::function<void(const std::string& line)>;
+using DiagnosticCallback  = std::function<void(const BuildDiagnostic& diagnostic)>;
+
+// Parse a line of GCC/binutils/make output. Returns true if the line is a diagnostic.
+bool parseBuildDiagnostic(const std::string& line, BuildDiagnostic& diagnostic);
+
+// Launch a command and hand its combined stdout/stderr back line by line as it arrives.
+// Any diagnostics found are passed to diagnosticCallback as they are parsed. When abortOnFirstError
+// is set, the whole process group (e.g. make and all of its compiler jobs) is stopped on the first error.
+// The process group is also stopped when cancelRequest becomes true or timeoutSeconds expires (0 = no timeout).
+// The full output is optionally returned in output and how the process ended in status, the caller reports
+// timeouts and cancellation. Returns SUCCESS if the command exits cleanly with no errors.
+int LaunchProcessStreaming(const std::string& command, const std::string& workingDirectory,
+    ProcessLineCallback lineCallback, DiagnosticCallback diagnosticCallback,
+    bool abortOnFirstError = false, unsigned timeoutSeconds = 0,
+    const std::atomic<bool>* cancelRequest = nullptr, std::string* output = nullptr,
+    ProcessStreamStatus* status = nullptr);
+
+}
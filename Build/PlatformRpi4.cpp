@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
 #include <JuceHeader.h>
 #include "Util/FileUtil.h"
 #include "Util/ErrorMessage.h"
@@ -6,8 +11,11 @@
 #include "Util/GuiUtil.h"
 #include "Build/PlatformRpi4.h"
 #include "Build/LaunchProcess.h"
+#include "Build/LaunchProcessStream.h"
+#include "Build/RelocatableModule.h"
 
 #include "Resources/bsp/bsp_RPI4B.h"
+#include "Resources/bsp/arm_math_neon_RPI4B.h"
 
 #if defined(LINUX)
 #include "Resources/BinaryToolsRpi4Linux.h"
@@ -32,6 +40,9 @@ namespace platform {
 static int g_binarySizeBytes = -1;
 static std::string g_programmingFilePath;
 static float g_programmingProgress = 0.0f;
+static std::atomic<bool> g_programThreadExit(false);
+static std::string g_programmingIpAddress = IP_ADDRESS;
+static unsigned g_programmingPort = PlatformRpi4b::DEFAULT_TFTP_PORT;
 
 PlatformRpi4b::PlatformRpi4b(PlatformEnum platformEnum)
 : PlatformBase(platformEnum)
@@ -67,17 +78,69 @@ void PlatformRpi4b::configPlatform()
 
     m_platformConfig.productName = "STRIDE-MKII";
     m_platformConfig.mcuTypeName = "RPI4B";
+
+    // Core 0 services the audio I/O, USB and network interrupts so it carries the base load,
+    // the secondary cores are dedicated to effect stages.
+    for (unsigned core = 0; core < NUM_CPU_CORES; core++) {
+        m_coreCpuBudget[core] = m_platformConfig.CPU_SAFETY_THRESHOLD;
+    }
+    m_coreCpuBudget[0] -= m_platformConfig.BASE_CPU_LOAD_PERCENT;
+}
+
+float PlatformRpi4b::getCoreCpuBudget(unsigned core)
+{
+    if (core >= NUM_CPU_CORES) { return 0.0f; }
+    return m_coreCpuBudget[core];
 }
 
 std::vector<std::string> PlatformRpi4b::getExtraIncludeLibs()
 {
     std::vector<std::string> libs;
     libs.push_back("arm_math");
+    libs.push_back("arm_math_neon");
     return libs;
 }
 
-const char* PlatformRpi4b::getCoreIncludesZip() { return bsp_RPI4B::includes_RPI4B_zip; }
-size_t      PlatformRpi4b::getCoreIncludesZipSize() { return bsp_RPI4B::includes_RPI4B_zipSize; }
+// arm_math_neon lives in this tree (Libraries/arm_math_neon) rather than in the core BSP, so it is added to the
+// BSP includes zip next to arm_math. Regenerate Resources/bsp/arm_math_neon_RPI4B.* with BinaryBuilder when
+// the header changes, Tests/ArmMathNeonResourceTest checks they match.
+static const MemoryBlock& getIncludesZip()
+{
+    static const MemoryBlock includesZip = []() {
+        MemoryInputStream bspStream(bsp_RPI4B::includes_RPI4B_zip, bsp_RPI4B::includes_RPI4B_zipSize, false);
+        ZipFile bspZip(bspStream);
+
+        // Use the same root as arm_math, and leave the zip alone once the BSP packages the library itself
+        String libraryRoot;
+        for (int i = 0; i < bspZip.getNumEntries(); i++) {
+            String entryName = bspZip.getEntry(i)->filename.replaceCharacter('\\', '/');
+            if (entryName.contains("arm_math_neon/")) {
+                return MemoryBlock(bsp_RPI4B::includes_RPI4B_zip, bsp_RPI4B::includes_RPI4B_zipSize);
+            }
+            if (entryName.endsWith("arm_math/arm_math.h")) { libraryRoot = entryName.dropLastCharacters(String("arm_math/arm_math.h").length()); }
+        }
+
+        ZipFile::Builder builder;
+        for (int i = 0; i < bspZip.getNumEntries(); i++) {
+            const ZipFile::ZipEntry* entry = bspZip.getEntry(i);
+            if (entry->filename.endsWithChar('/')) { continue; } // directories are recreated from the file paths
+            builder.addEntry(bspZip.createStreamForEntry(i), 9, entry->filename, entry->fileTime);
+        }
+        builder.addEntry(new MemoryInputStream(arm_math_neon_RPI4B::arm_math_neon_h, arm_math_neon_RPI4B::arm_math_neon_hSize, false),
+            9, libraryRoot + "arm_math_neon/arm_math_neon.h", Time::getCurrentTime());
+
+        MemoryOutputStream zipStream;
+        if (!builder.writeToStream(zipStream, nullptr)) {
+            errorMessage("PlatformRpi4b::getCoreIncludesZip(): unable to add arm_math_neon to the includes zip");
+            return MemoryBlock(bsp_RPI4B::includes_RPI4B_zip, bsp_RPI4B::includes_RPI4B_zipSize);
+        }
+        return zipStream.getMemoryBlock();
+    }();
+    return includesZip;
+}
+
+const char* PlatformRpi4b::getCoreIncludesZip() { return static_cast<const char*>(getIncludesZip().getData()); }
+size_t      PlatformRpi4b::getCoreIncludesZipSize() { return getIncludesZip().getSize(); }
 const char* PlatformRpi4b::getCoreLibsZip() { return bsp_RPI4B::libs_RPI4B_zip; }
 size_t      PlatformRpi4b::getCoreLibsZipSize() {return bsp_RPI4B::libs_RPI4B_zipSize; }
 
@@ -145,6 +208,7 @@ std::string PlatformRpi4b::getMakefile()
 #if defined(LINUX)
 constexpr char BUILD_MAKEFILE[] = "\
 CPPFILT	= $(TOOL_PREFIX)c++filt\n\
+NM      ?= $(TOOL_PREFIX)nm\n\
 ARCHCPU	?= -DAARCH=64 -mcpu=cortex-a72 -mlittle-endian\n\
 CPPFLAGS += -ffreestanding -fno-rtti\n\
 CPPFLAGS += $(ARCHCPU)\n\
@@ -169,6 +233,9 @@ CXXFLAGS += -Wno-aligned-new\n\
 \n\
 LOADADDR = 0x80000\n\
 LDFLAGS += -O2 --gc-sections --relax --section-start=.init=$(LOADADDR)\n\
+# core functions hot-load modules may call, --gc-sections drops anything the image doesn't use itself\n\
+MODULE_EXPORTS ?=\n\
+LDFLAGS += $(addprefix --undefined=,$(MODULE_EXPORTS))\n\
 \n\
 SYS_STAT_LIBS += --whole-archive $(addprefix -l:, $(DATAPAK_LIST)) --no-whole-archive\n\
 \n\
@@ -180,6 +247,7 @@ $(TARGET): $(OBJ_FILES)\n\
 \t\t$(CRTBEGIN) $(OBJ_FILES) $(SYS_STAT_LIBS) $(CORE_LIBS) \\\n\
 \t--start-group $(CIRCLE_LIBS) --end-group $(CRTEND)\n\
 \t$(OBJDUMP) -d $(TARGET).elf | $(CPPFILT) > $(TARGET).lst\n\
+\t$(NM) --extern-only --defined-only $(TARGET).elf > $(TARGET).syms\n\
 \t$(OBJCOPY) $(TARGET).elf -O binary $(TARGET).img\n\
 \t$-cp $(TARGET).img kernel84.img\n\
 clean:\n\
@@ -500,10 +568,35 @@ bool PlatformRpi4b::isProgramFlashValid(const std::string& toolsDirectory, const
     // else { return true; }
 }
 
+static const char EFX_DEBUG_FLAGS[]   = "-g -O0 -D_DEBUG -DUSB_DUAL_SERIAL";
+static const char EFX_RELEASE_FLAGS[] = "-s -fvisibility=hidden -O3 -D NDEBUG -DUSB_MIDI_AUDIO_SERIAL";
+
+// Effect build outputs, relative to the effect project directory (BASE_DIR in makefile.inc)
+static const char EFX_OUTPUT_DIR[] = "../../efx";
+
+static std::string getEfxVariantDir(const std::string& efxDirectory, const std::string& variantName)
+{
+    return efxDirectory + "/variants/" + variantName;
+}
+
+static std::string getEfxCommonFlags(const Flags& flags)
+{
+    return flags.noPrintf ? "-DNO_EFX_PRINTF" : "";
+}
+
+static std::string getEfxReleaseFlags(const Flags& flags)
+{
+    std::string releaseFlags = EFX_RELEASE_FLAGS;
+    if (flags.enableFastMath) { releaseFlags += " -ffast-math";}
+    if (flags.enableO3) { releaseFlags += " -O3"; }
+    else                { releaseFlags += " -O2"; }
+    return releaseFlags;
+}
+
 std::string PlatformRpi4b::getEfxMakefileInc(const Flags flags, const std::string& cppFlags)
 {
     std::string commonFlags = "COMMON_FLAGS +=";
-    if (flags.noPrintf) { commonFlags += " -DNO_EFX_PRINTF"; }
+    commonFlags += " " + getEfxCommonFlags(flags);
 
     std::string defaultFlags;
     if (flags.isDebug) { defaultFlags = "DEFAULTFLAGS   = $(DEBUGFLAGS)"; }
@@ -528,9 +621,25 @@ ARCH=aarch64\n\
 INCLUDE_PATH = $(CURDIR)/extinc\n\
 SRCDIR = $(BASE_DIR)/src\n\
 OBJDIR = $(BASE_DIR)/obj\n\
+MODULE_OBJDIR = $(BASE_DIR)/objmod\n\
 INCDIR = $(BASE_DIR)/inc\n\
-EFXDIR=$(BASE_DIR)/../../efx\n\
-OUTPUT_DIRS=$(EFXDIR) $(OBJDIR)\n\
+";
+    makefileIncStr += "EFXDIR=$(BASE_DIR)/" + std::string(EFX_OUTPUT_DIR) + NEWLINE;
+    makefileIncStr += "\
+\n\
+# Flag set variants (VARIANT_NAME=...) get their own object and output directories so they can build concurrently\n\
+VARIANT_NAME ?=\n\
+ifneq ($(VARIANT_NAME),)\n\
+OBJDIR = $(BASE_DIR)/obj/$(VARIANT_NAME)\n\
+MODULE_OBJDIR = $(BASE_DIR)/objmod/$(VARIANT_NAME)\n\
+";
+    makefileIncStr += "OUTDIR = " + getEfxVariantDir("$(EFXDIR)", "$(VARIANT_NAME)") + NEWLINE;
+    makefileIncStr += "\
+else\n\
+OUTDIR = $(EFXDIR)\n\
+endif\n\
+\n\
+OUTPUT_DIRS=$(EFXDIR) $(OUTDIR) $(OBJDIR) $(MODULE_OBJDIR)\n\
 MKDIR_P = mkdir -p\n\
 " + NEWLINE;
 
@@ -571,8 +680,8 @@ ifeq ($(AVALON_REV),2)\n\
 CPPFLAGS += -DAVALON_REV2\n\
 endif\n\
 \n\
-RPI4LIBS_INCLUDE_LIST = arm_math globalCompat sysPlatformRpi4 Avalon Stride Audio\n\
-RPI4LIBS_COMMA_LIST = \"arm_math,globalCompat,sysPlatfromRpi4,Avalon,Stride,Audio\"\n\
+RPI4LIBS_INCLUDE_LIST = arm_math arm_math_neon globalCompat sysPlatformRpi4 Avalon Stride Audio\n\
+RPI4LIBS_COMMA_LIST = \"arm_math,arm_math_neon,globalCompat,sysPlatfromRpi4,Avalon,Stride,Audio\"\n\
 \n\
 RPI4LIBS_INCLUDE_PATHS = $(addprefix -I$(INCLUDE_PATH)/, $(RPI4LIBS_INCLUDE_LIST))\n\
 INCLUDE_PATHS += $(RPI4LIBS_INCLUDE_PATHS)\n\
@@ -584,11 +693,13 @@ CXXFLAGS += -std=gnu++17 -fpermissive -fno-rtti -fno-threadsafe-statics -felide-
 # Archiver flags\n\
 ARFLAGS   = -cr\n\
 \n\
-DEBUGFLAGS     = -g -O0 -D_DEBUG -DUSB_DUAL_SERIAL\n\
-RELEASEFLAGS   = -s -fvisibility=hidden -O3 -D NDEBUG -DUSB_MIDI_AUDIO_SERIAL";
-if (flags.enableFastMath) { makefileIncStr += " -ffast-math";}
-if (flags.enableO3) { makefileIncStr += " -O3\n"; }
-else                { makefileIncStr += " -O2\n"; }
+# Hot-load module flags, position-independent code partially linked against the core\n\
+MODULEFLAGS   = -fPIC -fno-plt -DAVALON_HOTLOAD_MODULE\n\
+MODULE_LDFLAGS = -r -d\n\
+\n\
+";
+    makefileIncStr += std::string("DEBUGFLAGS     = ") + EFX_DEBUG_FLAGS + NEWLINE;
+    makefileIncStr += "RELEASEFLAGS   = " + getEfxReleaseFlags(flags) + NEWLINE;
     makefileIncStr += defaultFlags + NEWLINE;
     makefileIncStr += "\nSTATIC_TARGET_LIST = $(TARGET_NAME).$(PLATFORM_NAME).dat\n\
 \n\
@@ -601,41 +712,58 @@ SOURCES_S = $(addprefix $(SRCDIR)/, $(S_SRC_LIST))\n\
 OBJECTS_CPP = $(addsuffix .o, $(addprefix $(OBJDIR)/, $(CPP_SRC_LIST)))\n\
 OBJECTS_C = $(addsuffix .o, $(addprefix $(OBJDIR)/, $(C_SRC_LIST)))\n\
 OBJECTS_S = $(addsuffix .o, $(addprefix $(OBJDIR)/, $(S_SRC_LIST)))\n\
+MODULE_OBJECTS = $(addsuffix .o, $(addprefix $(MODULE_OBJDIR)/, $(C_SRC_LIST) $(CPP_SRC_LIST) $(S_SRC_LIST)))\n\
 \n\
 PREPROC_DEFINES = $(addprefix -D, $(PREPROC_DEFINES_LIST))\n\
 CPPFLAGS += $(PREPROC_DEFINES)\n\
 " + NEWLINE;
 
-    makefileIncStr += "STATIC_TARGET = $(EFXDIR)/$(STATIC_TARGET_LIST)\n" + NEWLINE;
+    makefileIncStr += "STATIC_TARGET = $(OUTDIR)/$(STATIC_TARGET_LIST)\n";
+    makefileIncStr += "MODULE_TARGET = $(OUTDIR)/$(TARGET_NAME).$(PLATFORM_NAME).mod\n" + NEWLINE;
 
     makefileIncStr += "all: directories api_headers $(STATIC_TARGET)\n\
 \n\
+# order-only so parallel (-j) builds create the output directories before any recipe writes to them\n\
 directories:\n\
 \t$(TMOD)$(MKDIR_P) $(OUTPUT_DIRS)\n\
 \n\
-api_headers:\n\
-\t$(TMOD)-cp -f $(API_HEADERS) $(EFXDIR)\n\
+api_headers: | directories\n\
+\t$(TMOD)-cp -f $(API_HEADERS) $(OUTDIR)\n\
 \n\
-$(STATIC_TARGET): $(OBJECTS_C) $(OBJECTS_CPP) $(OBJECTS_S)\n\
+$(STATIC_TARGET): $(OBJECTS_C) $(OBJECTS_CPP) $(OBJECTS_S) | directories\n\
 \t$(AR) $(ARFLAGS) $(STATIC_TARGET) $(OBJECTS_C) $(OBJECTS_CPP) $(OBJECTS_S)\n\
 \n\
-$(OBJDIR)%.cpp.o: $(SRCDIR)%.cpp\n\
+$(OBJDIR)%.cpp.o: $(SRCDIR)%.cpp | directories\n\
 \t$(TMOD)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(DEFAULTFLAGS) -c -o $@ $<\n\
 \n\
-$(OBJDIR)%.c.o: $(SRCDIR)%.c\n\
+$(OBJDIR)%.c.o: $(SRCDIR)%.c | directories\n\
 \t$(TMOD)$(CC) $(CPPFLAGS) $(CFLAGS) $(DEFAULTFLAGS) -c -o $@ $<\n\
 \n\
-$(OBJDIR)%.S.o: $(SRCDIR)%.S\n\
+$(OBJDIR)%.S.o: $(SRCDIR)%.S | directories\n\
 \t$(TMOD)$(CC) $(CPPFLAGS) -x assembler-with-cpp $(DEFAULTFLAGS) -c -o $@ $<\n\
 \n\
+module: directories api_headers $(MODULE_TARGET)\n\
+\n\
+$(MODULE_TARGET): $(MODULE_OBJECTS) | directories\n\
+\t$(LD) $(MODULE_LDFLAGS) -o $(MODULE_TARGET) $(MODULE_OBJECTS)\n\
+\n\
+$(MODULE_OBJDIR)%.cpp.o: $(SRCDIR)%.cpp | directories\n\
+\t$(TMOD)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(DEFAULTFLAGS) $(MODULEFLAGS) -c -o $@ $<\n\
+\n\
+$(MODULE_OBJDIR)%.c.o: $(SRCDIR)%.c | directories\n\
+\t$(TMOD)$(CC) $(CPPFLAGS) $(CFLAGS) $(DEFAULTFLAGS) $(MODULEFLAGS) -c -o $@ $<\n\
+\n\
+$(MODULE_OBJDIR)%.S.o: $(SRCDIR)%.S | directories\n\
+\t$(TMOD)$(CC) $(CPPFLAGS) -x assembler-with-cpp $(DEFAULTFLAGS) $(MODULEFLAGS) -c -o $@ $<\n\
+\n\
 clean:\n\
-\t$(TMOD)-rm -f $(OBJECTS_C) $(OBJECTS_CPP) $(OBJECTS_S)\n\
-\t$(TMOD)-rm -f $(DYN_TARGET) $(STATIC_TARGET)\n\
-\t$(TMOD)-rm -f $(EFXDIR)/*.h $(EFXDIR)/*.efx\n\
+\t$(TMOD)-rm -f $(OBJECTS_C) $(OBJECTS_CPP) $(OBJECTS_S) $(MODULE_OBJECTS)\n\
+\t$(TMOD)-rm -f $(DYN_TARGET) $(STATIC_TARGET) $(MODULE_TARGET)\n\
+\t$(TMOD)-rm -f $(OUTDIR)/*.h $(OUTDIR)/*.efx\n\
 \t$(TMOD)-rm -f $(ZIPDIR)/$(TARGET_NAME).zip\n\
 printvar:\n\
 \t$(foreach v, $(.VARIABLES), $(info $(v) = $($(v))))\n\
-.PHONY: directories api_headers clean printvar\n\
+.PHONY: directories api_headers module clean printvar\n\
 " + NEWLINE;
 
     return makefileIncStr;
@@ -648,6 +776,123 @@ printvar:\n\
 #endif
 }
 
+std::string PlatformRpi4b::getVariantName(const Flags& flags)
+{
+    // Debug builds always use EFX_DEBUG_FLAGS, so the optimization flags don't apply to them
+    std::string variantName = flags.isDebug ? "debug" : "release";
+    if (!flags.isDebug) {
+        variantName += flags.enableO3 ? "-O3" : "-O2";
+        if (flags.enableFastMath) { variantName += "-fastmath"; }
+    }
+    if (flags.noPrintf) { variantName += "-noprintf"; }
+    return variantName;
+}
+
+int PlatformRpi4b::buildVariantMatrix(const std::string& projectDirectory, const std::string& targetName,
+    const std::vector<Flags>& variants, std::vector<VariantBuildResult>& results, unsigned jobsPerVariant,
+    const std::atomic<bool>* cancelRequest)
+{
+#if defined(MACOS)
+    const std::string makeCommand = projectDirectory + "/tools/gmake";
+#else
+    const std::string makeCommand = "make";
+#endif
+    const std::string sizeCommand = projectDirectory + "/tools/bin/" + m_platformConfig.TOOLCHAIN_PREFIX + "-size";
+
+    // Variants that produce the same build share a directory, so only build each one once
+    std::vector<Flags> uniqueVariants;
+    results.clear();
+    for (auto& variant : variants) {
+        std::string variantName = getVariantName(variant);
+        bool isDuplicate = std::any_of(results.begin(), results.end(),
+            [&](const VariantBuildResult& result) { return result.variantName == variantName; });
+        if (isDuplicate) { continue; }
+        uniqueVariants.push_back(variant);
+        results.emplace_back();
+        results.back().variantName = variantName;
+    }
+    std::vector<std::string> outputs(results.size());
+
+    // The variants only differ in the flags passed on the make command line, the makefile gives each its own directories
+    std::vector<std::thread> buildThreads;
+    for (size_t i = 0; i < uniqueVariants.size(); i++) {
+        const Flags& variant = uniqueVariants[i];
+        std::string defaultFlags = variant.isDebug ? std::string(EFX_DEBUG_FLAGS) : getEfxReleaseFlags(variant);
+        std::string command = makeCommand + " -j" + std::to_string(std::max(jobsPerVariant, 1u)) +
+            " VARIANT_NAME=" + results[i].variantName +
+            " 'DEFAULTFLAGS=" + defaultFlags + "'" +
+            " 'COMMON_FLAGS=" + getEfxCommonFlags(variant) + "' all";
+
+        buildThreads.emplace_back([&, i, command]() {
+            auto startTime = std::chrono::steady_clock::now();
+            results[i].buildResult = LaunchProcessStreaming(command, projectDirectory, nullptr, nullptr,
+                true /* abort on first error */, 0, cancelRequest, &outputs[i]);
+            results[i].buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        });
+    }
+    for (auto& buildThread : buildThreads) { buildThread.join(); }
+
+    bool allPassed = true;
+    for (size_t i = 0; i < results.size(); i++) {
+        VariantBuildResult& result = results[i];
+        if (result.buildResult != SUCCESS) {
+            errorMessage("PlatformRpi4b::buildVariantMatrix(): BUILD ERROR in " + result.variantName + "\n" + outputs[i]);
+            allPassed = false;
+            continue;
+        }
+
+        std::string archivePath = getEfxVariantDir(projectDirectory + "/" + EFX_OUTPUT_DIR, result.variantName) + "/" +
+            targetName + "." + m_platformConfig.productName + ".dat";
+        result.archiveBytes = FileUtil::getFileSize(archivePath);
+
+        // the TOTALS line of size -t is "text data bss dec hex filename (TOTALS)"
+        std::string sizeOutput;
+        LaunchProcessCommand(sizeCommand + " -t " + archivePath, sizeOutput, projectDirectory);
+        std::istringstream sizeStream(sizeOutput);
+        std::string line;
+        while (std::getline(sizeStream, line)) {
+            if (line.find("(TOTALS)") == std::string::npos) { continue; }
+            std::istringstream lineStream(line);
+            lineStream >> result.textBytes >> result.dataBytes >> result.bssBytes;
+        }
+    }
+    return allPassed ? SUCCESS : FAILURE;
+}
+
+std::string PlatformRpi4b::getVariantComparison(const std::vector<VariantBuildResult>& results)
+{
+    // sizes are compared against the first variant that built successfully
+    const VariantBuildResult* baseline = nullptr;
+    for (auto& result : results) {
+        if (result.buildResult == SUCCESS) { baseline = &result; break; }
+    }
+
+    auto percentDelta = [](size_t value, size_t baseValue) -> std::string {
+        if (baseValue == 0) { return "-"; }
+        char textBuf[32];
+        snprintf(textBuf, sizeof(textBuf), "%+.1f%%", 100.0 * (static_cast<double>(value) - baseValue) / baseValue);
+        return std::string(textBuf);
+    };
+
+    std::string comparison;
+    char textBuf[256];
+    snprintf(textBuf, sizeof(textBuf), "%-32s %10s %10s %8s %10s %10s %8s\n",
+        "variant", "archive", "delta", "text", "data", "bss", "build s");
+    comparison += textBuf;
+    for (auto& result : results) {
+        if (result.buildResult != SUCCESS) {
+            comparison += result.variantName + " BUILD FAILED\n";
+            continue;
+        }
+        snprintf(textBuf, sizeof(textBuf), "%-32s %10u %10s %8u %10u %10u %8.1f\n",
+            result.variantName.c_str(), (unsigned)result.archiveBytes,
+            percentDelta(result.archiveBytes, baseline->archiveBytes).c_str(),
+            (unsigned)result.textBytes, (unsigned)result.dataBytes, (unsigned)result.bssBytes, result.buildSeconds);
+        comparison += textBuf;
+    }
+    return comparison;
+}
+
 int  PlatformRpi4b::loadBinaryFile(const std::string& binaryFilePath)
 {
     size_t binarySize = FileUtil::getFileSize(binaryFilePath);
@@ -661,6 +906,28 @@ int  PlatformRpi4b::openUsb() {
     return SUCCESS;
 }
 
+// tftp reports transfer errors (e.g. "Error code 2: Access violation") in its output and can still exit with 0
+static std::string findTftpError(const std::string& output)
+{
+    std::istringstream lines(output);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.find("Error") != std::string::npos) { return line; }
+    }
+    return std::string();
+}
+
+static std::string getUploadFailureReason(const ProcessStreamStatus& status, const std::string& output,
+    unsigned timeoutSeconds)
+{
+    if (status.cancelled) { return "cancelled"; }
+    if (status.timedOut)  { return "no response after " + std::to_string(timeoutSeconds) + " seconds"; }
+    std::string tftpError = findTftpError(output);
+    if (!tftpError.empty()) { return tftpError; }
+    if (status.exitCode < 0) { return "tftp did not exit normally"; }
+    return "tftp exited with code " + std::to_string(status.exitCode);
+}
+
 int PlatformRpi4b::programDevice() {
 
     // TODO: we need to replace tftp with uploading over the USB serial
@@ -668,20 +935,25 @@ int PlatformRpi4b::programDevice() {
 
     g_programmingProgress = 0.0f;
 
-    std::string ipAddress = std::string(IP_ADDRESS);
+    std::string ipAddress = g_programmingIpAddress + " " + std::to_string(g_programmingPort);
     std::string buildFolder = FileUtil::getFolderFromPath(g_programmingFilePath);
     std::string command = "tftp -m binary " + ipAddress + " -c put kernel84.img";
 
+    constexpr unsigned TIMEOUT_SECONDS = 60;
     std::string result;
     std::string msg;
-    LaunchProcessCommand(command, result, buildFolder, 60 /* TIMEOUT SECONDS*/);
-    if (result.find("Error") != std::string::npos) {
-        std::string msg = std::string(__DATE__) + ": BuildThread::run(): BUILD ERROR\n";
-        msg += result;
-        errorMessage(msg);
+    ProcessStreamStatus status;
+    g_programThreadExit = false;
+    // The tftp output is streamed as it arrives, so the error only needs the summary
+    int ret = LaunchProcessStreaming(command, buildFolder,
+        [](const std::string& line) { noteMessage(line); }, nullptr,
+        false /* abort on first error */, TIMEOUT_SECONDS, &g_programThreadExit, &result, &status);
+    if ((ret != SUCCESS) || !findTftpError(result).empty()) {
+        errorMessage("PlatformRpi4b::programDevice(): upload to " + g_programmingIpAddress + " failed: " +
+            getUploadFailureReason(status, result, TIMEOUT_SECONDS) + "\n");
         return FAILURE;
     } else {
-        msg = "*** " + std::string(__DATE__) + ": RESULT: *** \n" + result;
+        msg = "*** " + std::string(__DATE__) + ": RESULT: *** \n";
         noteMessage(msg);
         g_programmingProgress = 1.0f;
         return SUCCESS;
@@ -705,6 +977,60 @@ int PlatformRpi4b::programDevice() {
 #endif
 }
 
+int PlatformRpi4b::uploadModule(const std::string& moduleFilePath, const std::string& symbolFilePath)
+{
+    g_programmingProgress = 0.0f;
+
+    // Check the module resolves against the core first so a module that can't be loaded never reaches the device.
+    // The placeholder address only exercises the relocations, the device links the module at its own load address.
+    RelocatableModule module;
+    if (module.loadSymbolTable(symbolFilePath) != SUCCESS) { return FAILURE; }
+    if (module.loadModuleFile(moduleFilePath) != SUCCESS) { return FAILURE; }
+    if (module.link(0) != SUCCESS) {
+        errorMessage("PlatformRpi4b::uploadModule(): module does not link against the core, a full rebuild is required");
+        return FAILURE;
+    }
+
+    // The unlinked module is sent as efx.mod, the device links it and swaps it in between audio blocks
+    constexpr unsigned TIMEOUT_SECONDS = 10;
+    std::string ipAddress = g_programmingIpAddress + " " + std::to_string(g_programmingPort);
+    std::string moduleFolder = FileUtil::getFolderFromPath(moduleFilePath);
+    std::string command = "tftp -m binary " + ipAddress + " -c put " + moduleFilePath + " efx.mod";
+
+    std::string result;
+    ProcessStreamStatus status;
+    g_programThreadExit = false;
+    int ret = LaunchProcessStreaming(command, moduleFolder,
+        [](const std::string& line) { noteMessage(line); },
+        nullptr, false /* abort on first error */, TIMEOUT_SECONDS, &g_programThreadExit, &result, &status);
+    if ((ret != SUCCESS) || !findTftpError(result).empty()) {
+        errorMessage("PlatformRpi4b::uploadModule(): upload to " + g_programmingIpAddress + " failed: " +
+            getUploadFailureReason(status, result, TIMEOUT_SECONDS));
+        return FAILURE;
+    }
+
+    noteMessage("PlatformRpi4b::uploadModule(): sent " + std::to_string(FileUtil::getFileSize(moduleFilePath)) +
+        " bytes, the device links the module and swaps it in");
+    g_programmingProgress = 1.0f;
+    return SUCCESS;
+}
+
+void PlatformRpi4b::setProgrammingAddress(const std::string& ipAddress, unsigned port)
+{
+    g_programmingIpAddress = ipAddress.empty() ? std::string(IP_ADDRESS) : ipAddress;
+    g_programmingPort = port;
+}
+
+std::string PlatformRpi4b::getProgrammingAddress() const
+{
+    return g_programmingIpAddress;
+}
+
+unsigned PlatformRpi4b::getProgrammingPort() const
+{
+    return g_programmingPort;
+}
+
 float PlatformRpi4b::getProgrammingProgress()
 {
     return g_programmingProgress;
@@ -712,7 +1038,7 @@ float PlatformRpi4b::getProgrammingProgress()
 
 void PlatformRpi4b::requestProgramThreadExit()
 {
-
+    g_programThreadExit = true;
 }
 
 bool PlatformRpi4b::isEraseDone()
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,17 @@
 
 namespace platform {
 
+// Result of building one flag set variant of an effect
+struct VariantBuildResult {
+    std::string variantName;
+    int    buildResult  = -1;
+    double buildSeconds = 0.0;
+    size_t archiveBytes = 0;
+    size_t textBytes    = 0;
+    size_t dataBytes    = 0;
+    size_t bssBytes     = 0;
+};
+
 class PlatformRpi4b : public PlatformBase {
 public:
 
@@ -47,6 +59,35 @@ public:
     void requestProgramThreadExit() override;
     float getProgrammingProgress() override;
     bool isEraseDone() override;
+
+    // Per-core CPU budgets, core 0 carries the base load. Effects still run on core 0 until the core
+    // libs are built for multiple cores, the budgets let the editor report per-core headroom ahead of that.
+    static constexpr unsigned NUM_CPU_CORES = 4;
+
+    float getCoreCpuBudget(unsigned core);
+
+    // Check a hot-load effect module against the core symbols and send it to a running device, which links
+    // it at its own load address and swaps it in without reflashing the kernel
+    int uploadModule(const std::string& moduleFilePath, const std::string& symbolFilePath);
+
+    // Override the device address used for programming, e.g. to upload to a local receiver. An empty address restores the default.
+    void setProgrammingAddress(const std::string& ipAddress, unsigned port = DEFAULT_TFTP_PORT);
+    std::string getProgrammingAddress() const;
+    unsigned    getProgrammingPort() const;
+
+    static constexpr unsigned DEFAULT_TFTP_PORT = 69;
+
+    // Build several flag set variants of an effect concurrently, each in its own object and output directory.
+    // Variants with the same name are built once, results holds one entry per unique variant.
+    // The builds are stopped when cancelRequest becomes true.
+    std::string getVariantName(const Flags& flags);
+    int buildVariantMatrix(const std::string& projectDirectory, const std::string& targetName,
+        const std::vector<Flags>& variants, std::vector<VariantBuildResult>& results, unsigned jobsPerVariant = 1,
+        const std::atomic<bool>* cancelRequest = nullptr);
+    std::string getVariantComparison(const std::vector<VariantBuildResult>& results);
+
+private:
+    float m_coreCpuBudget[NUM_CPU_CORES];  // CPU percent available to effects on each core
 };
 
 }
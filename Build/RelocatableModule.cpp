@@ -0,0 +1,464 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "Util/CommonDefs.h"
+#include "Util/ErrorMessage.h"
+#include "Build/RelocatableModule.h"
+
+using namespace stride;
+
+namespace platform {
+
+// ELF64 constants, defined here rather than using <elf.h> which isn't available on every host
+constexpr uint8_t  ELFCLASS64    = 2;
+constexpr uint8_t  ELFDATA2LSB   = 1;
+constexpr uint16_t ET_REL        = 1;
+constexpr uint16_t EM_AARCH64    = 183;
+constexpr uint32_t SHT_SYMTAB    = 2;
+constexpr uint32_t SHT_RELA      = 4;
+constexpr uint32_t SHT_NOBITS    = 8;
+constexpr uint32_t SHT_INIT_ARRAY = 14;
+constexpr uint32_t SHT_FINI_ARRAY = 15;
+constexpr uint64_t SHF_ALLOC     = 0x2;
+constexpr uint16_t SHN_UNDEF     = 0;
+constexpr uint16_t SHN_LORESERVE = 0xff00;
+constexpr uint16_t SHN_ABS       = 0xfff1;
+constexpr uint16_t SHN_COMMON    = 0xfff2;
+constexpr uint8_t  STB_LOCAL     = 0;
+constexpr uint8_t  STB_WEAK      = 2;
+
+constexpr size_t ELF_HEADER_SIZE  = 64;
+constexpr size_t ELF_SECTION_SIZE = 64;
+constexpr size_t ELF_SYMBOL_SIZE  = 24;
+constexpr size_t ELF_RELA_SIZE    = 24;
+
+// AArch64 relocation types used by -fPIC code partially linked with ld -r
+constexpr uint32_t R_AARCH64_NONE               = 0;
+constexpr uint32_t R_AARCH64_ABS64              = 257;
+constexpr uint32_t R_AARCH64_ABS32              = 258;
+constexpr uint32_t R_AARCH64_PREL64             = 260;
+constexpr uint32_t R_AARCH64_PREL32             = 261;
+constexpr uint32_t R_AARCH64_ADR_PREL_PG_HI21   = 275;
+constexpr uint32_t R_AARCH64_ADD_ABS_LO12_NC    = 277;
+constexpr uint32_t R_AARCH64_LDST8_ABS_LO12_NC  = 278;
+constexpr uint32_t R_AARCH64_JUMP26             = 282;
+constexpr uint32_t R_AARCH64_CALL26             = 283;
+constexpr uint32_t R_AARCH64_LDST16_ABS_LO12_NC = 284;
+constexpr uint32_t R_AARCH64_LDST32_ABS_LO12_NC = 285;
+constexpr uint32_t R_AARCH64_LDST64_ABS_LO12_NC = 286;
+constexpr uint32_t R_AARCH64_LDST128_ABS_LO12_NC = 299;
+constexpr uint32_t R_AARCH64_ADR_GOT_PAGE       = 311;
+constexpr uint32_t R_AARCH64_LD64_GOT_LO12_NC   = 312;
+
+// Far larger than any effect, it only stops a corrupt section size or alignment from wrapping the layout
+constexpr uint64_t MAX_IMAGE_SIZE = 256ULL << 20;
+
+constexpr size_t   GOT_ENTRY_SIZE = 8;
+constexpr size_t   VENEER_SIZE    = 16;
+constexpr uint32_t VENEER_LDR_X16 = 0x58000050; // ldr x16, #8
+constexpr uint32_t VENEER_BR_X16  = 0xd61f0200; // br x16
+
+// The module data is little-endian AArch64, read and write it bytewise so the host endianness doesn't matter
+static uint64_t readLE(const uint8_t* ptr, size_t numBytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < numBytes; i++) { value |= static_cast<uint64_t>(ptr[i]) << (8*i); }
+    return value;
+}
+
+static void writeLE(uint8_t* ptr, uint64_t value, size_t numBytes)
+{
+    for (size_t i = 0; i < numBytes; i++) { ptr[i] = static_cast<uint8_t>(value >> (8*i)); }
+}
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment)
+{
+    if (alignment <= 1) { return value; }
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static bool isGotRelocation(uint32_t type)
+{
+    return (type == R_AARCH64_ADR_GOT_PAGE) || (type == R_AARCH64_LD64_GOT_LO12_NC);
+}
+
+static bool isBranchRelocation(uint32_t type)
+{
+    return (type == R_AARCH64_CALL26) || (type == R_AARCH64_JUMP26);
+}
+
+int RelocatableModule::loadSymbolTable(const std::string& symbolFilePath)
+{
+    std::ifstream symbolFile(symbolFilePath);
+    if (!symbolFile) { errorMessage("RelocatableModule::loadSymbolTable(): unable to open " + symbolFilePath); return FAILURE; }
+
+    // nm --extern-only --defined-only output, "<address> <type> <name>"
+    std::string line;
+    while (std::getline(symbolFile, line)) {
+        std::istringstream lineStream(line);
+        std::string addressStr, typeStr, name;
+        if (!(lineStream >> addressStr >> typeStr >> name)) { continue; }
+        try {
+            addCoreSymbol(name, std::stoull(addressStr, nullptr, 16));
+        } catch (...) {
+            continue;
+        }
+    }
+
+    if (m_coreSymbols.empty()) { errorMessage("RelocatableModule::loadSymbolTable(): no symbols found in " + symbolFilePath); return FAILURE; }
+    return SUCCESS;
+}
+
+void RelocatableModule::addCoreSymbol(const std::string& name, uint64_t address)
+{
+    m_coreSymbols[name] = address;
+}
+
+int RelocatableModule::loadModuleFile(const std::string& moduleFilePath)
+{
+    std::ifstream moduleFile(moduleFilePath, std::ios::binary);
+    if (!moduleFile) { errorMessage("RelocatableModule::loadModuleFile(): unable to open " + moduleFilePath); return FAILURE; }
+    std::vector<uint8_t> moduleData((std::istreambuf_iterator<char>(moduleFile)), std::istreambuf_iterator<char>());
+    return loadModule(moduleData);
+}
+
+int RelocatableModule::loadModule(const std::vector<uint8_t>& moduleData)
+{
+    m_moduleData = moduleData;
+    m_sections.clear();
+    m_symbols.clear();
+    m_image.clear();
+
+    const uint8_t* data = m_moduleData.data();
+    size_t dataSize = m_moduleData.size();
+
+    if ((dataSize < ELF_HEADER_SIZE) || (std::memcmp(data, "\x7f" "ELF", 4) != 0)) {
+        errorMessage("RelocatableModule::loadModule(): not an ELF file"); return FAILURE;
+    }
+    if ((data[4] != ELFCLASS64) || (data[5] != ELFDATA2LSB) ||
+        (readLE(data+16, 2) != ET_REL) || (readLE(data+18, 2) != EM_AARCH64)) {
+        errorMessage("RelocatableModule::loadModule(): module must be a little-endian AArch64 relocatable object"); return FAILURE;
+    }
+
+    uint64_t shoff     = readLE(data+40, 8);
+    uint16_t shentsize = static_cast<uint16_t>(readLE(data+58, 2));
+    uint16_t shnum     = static_cast<uint16_t>(readLE(data+60, 2));
+    uint16_t shstrndx  = static_cast<uint16_t>(readLE(data+62, 2));
+    // The offsets and sizes come from the file, so compare by subtraction where a sum could wrap
+    if ((shentsize != ELF_SECTION_SIZE) || (shoff > dataSize) ||
+        (static_cast<uint64_t>(shnum) * ELF_SECTION_SIZE > dataSize - shoff) || (shstrndx >= shnum)) {
+        errorMessage("RelocatableModule::loadModule(): invalid section header table"); return FAILURE;
+    }
+
+    for (unsigned i = 0; i < shnum; i++) {
+        const uint8_t* sh = data + shoff + i * ELF_SECTION_SIZE;
+        Section section;
+        section.nameIndex = static_cast<uint32_t>(readLE(sh, 4));
+        section.type      = static_cast<uint32_t>(readLE(sh+4, 4));
+        section.flags     = readLE(sh+8, 8);
+        section.offset    = readLE(sh+24, 8);
+        section.size      = readLE(sh+32, 8);
+        section.link      = static_cast<uint32_t>(readLE(sh+40, 4));
+        section.info      = static_cast<uint32_t>(readLE(sh+44, 4));
+        section.addralign = readLE(sh+48, 8);
+        section.entsize   = readLE(sh+56, 8);
+        if ((section.type != SHT_NOBITS) && ((section.offset > dataSize) || (section.size > dataSize - section.offset))) {
+            errorMessage("RelocatableModule::loadModule(): section data out of range"); return FAILURE;
+        }
+        m_sections.push_back(section);
+    }
+
+    auto getString = [&](const Section& strtab, uint64_t index) -> std::string {
+        if ((strtab.type == SHT_NOBITS) || (index >= strtab.size)) { return std::string(); }
+        const char* str = reinterpret_cast<const char*>(data + strtab.offset + index);
+        return std::string(str, strnlen(str, strtab.size - index));
+    };
+
+    const Section& shstrtab = m_sections[shstrndx];
+    for (auto& section : m_sections) {
+        section.name = getString(shstrtab, section.nameIndex);
+    }
+
+    // ld -r produces a single symbol table
+    for (auto& section : m_sections) {
+        if (section.type != SHT_SYMTAB) { continue; }
+        if ((section.entsize != ELF_SYMBOL_SIZE) || (section.link >= m_sections.size())) {
+            errorMessage("RelocatableModule::loadModule(): invalid symbol table"); return FAILURE;
+        }
+        const Section& strtab = m_sections[section.link];
+        for (uint64_t offset = 0; offset + ELF_SYMBOL_SIZE <= section.size; offset += ELF_SYMBOL_SIZE) {
+            const uint8_t* sym = data + section.offset + offset;
+            Symbol symbol;
+            symbol.name  = getString(strtab, readLE(sym, 4));
+            symbol.info  = sym[4];
+            symbol.shndx = static_cast<uint16_t>(readLE(sym+6, 2));
+            symbol.value = readLE(sym+8, 8);
+            m_symbols.push_back(symbol);
+        }
+        break;
+    }
+    if (m_symbols.empty()) { errorMessage("RelocatableModule::loadModule(): no symbol table found"); return FAILURE; }
+
+    return SUCCESS;
+}
+
+int RelocatableModule::resolveSymbol(uint32_t symbolIndex, uint64_t& address)
+{
+    if (symbolIndex >= m_symbols.size()) { errorMessage("RelocatableModule::resolveSymbol(): invalid symbol index"); return FAILURE; }
+    const Symbol& symbol = m_symbols[symbolIndex];
+
+    if (symbol.shndx == SHN_UNDEF) {
+        if (symbolIndex == 0) { address = 0; return SUCCESS; } // R_AARCH64_NONE and friends
+        auto it = m_coreSymbols.find(symbol.name);
+        if (it != m_coreSymbols.end()) { address = it->second; return SUCCESS; }
+        if ((symbol.info >> 4) == STB_WEAK) { address = 0; return SUCCESS; }
+        if (std::find(m_unresolvedSymbols.begin(), m_unresolvedSymbols.end(), symbol.name) == m_unresolvedSymbols.end()) {
+            m_unresolvedSymbols.push_back(symbol.name);
+        }
+        return FAILURE;
+    }
+    if (symbol.shndx == SHN_ABS) { address = symbol.value; return SUCCESS; }
+    if (symbol.shndx == SHN_COMMON) {
+        errorMessage("RelocatableModule::resolveSymbol(): common symbol " + symbol.name + ", link the module with ld -r -d");
+        return FAILURE;
+    }
+    if ((symbol.shndx >= SHN_LORESERVE) || (symbol.shndx >= m_sections.size()) || !(m_sections[symbol.shndx].flags & SHF_ALLOC)) {
+        errorMessage("RelocatableModule::resolveSymbol(): symbol " + symbol.name + " is not in a loadable section");
+        return FAILURE;
+    }
+    address = m_loadAddress + m_sections[symbol.shndx].imageOffset + symbol.value;
+    return SUCCESS;
+}
+
+int RelocatableModule::link(uint64_t loadAddress)
+{
+    if (m_sections.empty()) { errorMessage("RelocatableModule::link(): no module loaded"); return FAILURE; }
+
+    m_loadAddress = loadAddress;
+    m_image.clear();
+    m_unresolvedSymbols.clear();
+    m_gotEntries.clear();
+    m_veneers.clear();
+
+    // Lay out the allocated sections in section order
+    uint64_t imageSize = 0;
+    for (auto& section : m_sections) {
+        if (!(section.flags & SHF_ALLOC)) { continue; }
+        if ((section.addralign > MAX_IMAGE_SIZE) || (section.size > MAX_IMAGE_SIZE)) {
+            errorMessage("RelocatableModule::link(): section " + section.name + " is too large"); return FAILURE;
+        }
+        imageSize = alignUp(imageSize, section.addralign);
+        section.imageOffset = imageSize;
+        imageSize += section.size;
+        if (imageSize > MAX_IMAGE_SIZE) { errorMessage("RelocatableModule::link(): module is too large"); return FAILURE; }
+    }
+
+    // Followed by the GOT, and veneers for branches out to the core, which may be out of B/BL range
+    imageSize = alignUp(imageSize, GOT_ENTRY_SIZE);
+    for (auto& section : m_sections) {
+        if ((section.type != SHT_RELA) || (section.info >= m_sections.size()) || !(m_sections[section.info].flags & SHF_ALLOC)) { continue; }
+        for (uint64_t offset = 0; offset + ELF_RELA_SIZE <= section.size; offset += ELF_RELA_SIZE) {
+            const uint8_t* rela = m_moduleData.data() + section.offset + offset;
+            uint64_t info   = readLE(rela+8, 8);
+            int64_t  addend = static_cast<int64_t>(readLE(rela+16, 8));
+            uint32_t symbolIndex = static_cast<uint32_t>(info >> 32);
+            uint32_t type        = static_cast<uint32_t>(info);
+
+            if (isGotRelocation(type) && (m_gotEntries.count({symbolIndex, addend}) == 0)) {
+                m_gotEntries[{symbolIndex, addend}] = imageSize;
+                imageSize += GOT_ENTRY_SIZE;
+            }
+        }
+    }
+    for (auto& section : m_sections) {
+        if ((section.type != SHT_RELA) || (section.info >= m_sections.size()) || !(m_sections[section.info].flags & SHF_ALLOC)) { continue; }
+        for (uint64_t offset = 0; offset + ELF_RELA_SIZE <= section.size; offset += ELF_RELA_SIZE) {
+            const uint8_t* rela = m_moduleData.data() + section.offset + offset;
+            uint64_t info = readLE(rela+8, 8);
+            uint32_t symbolIndex = static_cast<uint32_t>(info >> 32);
+            uint32_t type        = static_cast<uint32_t>(info);
+
+            if (isBranchRelocation(type) && (symbolIndex < m_symbols.size()) &&
+                (m_symbols[symbolIndex].shndx == SHN_UNDEF) && (m_veneers.count(symbolIndex) == 0)) {
+                m_veneers[symbolIndex] = imageSize;
+                imageSize += VENEER_SIZE;
+            }
+        }
+    }
+
+    m_image.assign(imageSize, 0);
+    for (auto& section : m_sections) {
+        if (!(section.flags & SHF_ALLOC) || (section.type == SHT_NOBITS)) { continue; }
+        std::memcpy(m_image.data() + section.imageOffset, m_moduleData.data() + section.offset, section.size);
+    }
+
+    bool failed = false;
+    for (auto& entry : m_gotEntries) {
+        uint64_t address = 0;
+        if (resolveSymbol(entry.first.first, address) != SUCCESS) { failed = true; continue; }
+        writeLE(m_image.data() + entry.second, address + entry.first.second, GOT_ENTRY_SIZE);
+    }
+    for (auto& veneer : m_veneers) {
+        uint64_t address = 0;
+        if (resolveSymbol(veneer.first, address) != SUCCESS) { failed = true; continue; }
+        uint8_t* ptr = m_image.data() + veneer.second;
+        writeLE(ptr,   VENEER_LDR_X16, 4);
+        writeLE(ptr+4, VENEER_BR_X16,  4);
+        writeLE(ptr+8, address, 8);
+    }
+
+    for (auto& section : m_sections) {
+        if ((section.type != SHT_RELA) || (section.info >= m_sections.size()) || !(m_sections[section.info].flags & SHF_ALLOC)) { continue; }
+        const Section& target = m_sections[section.info];
+
+        for (uint64_t offset = 0; offset + ELF_RELA_SIZE <= section.size; offset += ELF_RELA_SIZE) {
+            const uint8_t* rela = m_moduleData.data() + section.offset + offset;
+            uint64_t relOffset = readLE(rela, 8);
+            uint64_t info      = readLE(rela+8, 8);
+            int64_t  addend    = static_cast<int64_t>(readLE(rela+16, 8));
+            uint32_t symbolIndex = static_cast<uint32_t>(info >> 32);
+            uint32_t type        = static_cast<uint32_t>(info);
+
+            if (type == R_AARCH64_NONE) { continue; }
+            uint64_t relocSize = ((type == R_AARCH64_ABS64) || (type == R_AARCH64_PREL64)) ? 8 : 4;
+            if ((target.type == SHT_NOBITS) || (relOffset > target.size) || (relocSize > target.size - relOffset)) {
+                errorMessage("RelocatableModule::link(): relocation offset out of range in " + target.name);
+                failed = true; continue;
+            }
+
+            uint64_t symbolAddress = 0;
+            if (resolveSymbol(symbolIndex, symbolAddress) != SUCCESS) { failed = true; continue; }
+
+            uint64_t gotAddress = 0;
+            auto gotIt = m_gotEntries.find({symbolIndex, addend});
+            if (gotIt != m_gotEntries.end()) { gotAddress = m_loadAddress + gotIt->second; }
+            uint64_t veneerAddress = 0;
+            auto veneerIt = m_veneers.find(symbolIndex);
+            if (veneerIt != m_veneers.end()) { veneerAddress = m_loadAddress + veneerIt->second; }
+
+            if (applyRelocation(type, target.imageOffset + relOffset, symbolAddress, addend, gotAddress, veneerAddress) != SUCCESS) {
+                errorMessage("RelocatableModule::link(): unable to apply relocation type " + std::to_string(type) +
+                    " for " + m_symbols[symbolIndex].name + " in " + target.name);
+                failed = true;
+            }
+        }
+    }
+
+    for (auto& name : m_unresolvedSymbols) {
+        errorMessage("RelocatableModule::link(): unresolved symbol " + name);
+    }
+    return failed ? FAILURE : SUCCESS;
+}
+
+int RelocatableModule::applyRelocation(uint32_t type, uint64_t placeOffset, uint64_t symbolAddress, int64_t addend,
+    uint64_t gotAddress, uint64_t veneerAddress)
+{
+    uint8_t* ptr = m_image.data() + placeOffset;
+    uint64_t place = m_loadAddress + placeOffset;
+    uint64_t value = symbolAddress + static_cast<uint64_t>(addend);
+    uint32_t insn  = static_cast<uint32_t>(readLE(ptr, 4));
+
+    auto page = [](uint64_t address) { return address & ~static_cast<uint64_t>(0xfff); };
+    auto encodeAdrp = [&](uint64_t target) -> int {
+        int64_t pageDelta = static_cast<int64_t>(page(target) - page(place)) >> 12;
+        if ((pageDelta < -(1LL << 20)) || (pageDelta >= (1LL << 20))) { return FAILURE; }
+        uint32_t imm = static_cast<uint32_t>(pageDelta) & 0x1fffff;
+        insn = (insn & 0x9f00001f) | ((imm & 0x3) << 29) | ((imm >> 2) << 5);
+        writeLE(ptr, insn, 4);
+        return SUCCESS;
+    };
+    auto encodeLo12 = [&](uint64_t target, unsigned shift) -> int {
+        uint32_t imm = static_cast<uint32_t>((target & 0xfff) >> shift);
+        insn = (insn & 0xffc003ff) | (imm << 10);
+        writeLE(ptr, insn, 4);
+        return SUCCESS;
+    };
+
+    switch (type) {
+    case R_AARCH64_ABS64 :
+        writeLE(ptr, value, 8);
+        return SUCCESS;
+    case R_AARCH64_ABS32 :
+        if (value > 0xffffffffULL) { return FAILURE; }
+        writeLE(ptr, value, 4);
+        return SUCCESS;
+    case R_AARCH64_PREL64 :
+        writeLE(ptr, value - place, 8);
+        return SUCCESS;
+    case R_AARCH64_PREL32 : {
+        int64_t delta = static_cast<int64_t>(value - place);
+        if ((delta < INT32_MIN) || (delta > INT32_MAX)) { return FAILURE; }
+        writeLE(ptr, static_cast<uint64_t>(delta), 4);
+        return SUCCESS;
+    }
+    case R_AARCH64_ADR_PREL_PG_HI21 :
+        return encodeAdrp(value);
+    case R_AARCH64_ADR_GOT_PAGE :
+        return encodeAdrp(gotAddress);
+    case R_AARCH64_ADD_ABS_LO12_NC :
+    case R_AARCH64_LDST8_ABS_LO12_NC :
+        return encodeLo12(value, 0);
+    case R_AARCH64_LDST16_ABS_LO12_NC :
+        return encodeLo12(value, 1);
+    case R_AARCH64_LDST32_ABS_LO12_NC :
+        return encodeLo12(value, 2);
+    case R_AARCH64_LDST64_ABS_LO12_NC :
+        return encodeLo12(value, 3);
+    case R_AARCH64_LDST128_ABS_LO12_NC :
+        return encodeLo12(value, 4);
+    case R_AARCH64_LD64_GOT_LO12_NC :
+        return encodeLo12(gotAddress, 3);
+    case R_AARCH64_CALL26 :
+    case R_AARCH64_JUMP26 : {
+        uint64_t target = veneerAddress ? veneerAddress : value;
+        int64_t delta = static_cast<int64_t>(target - place);
+        if ((delta & 0x3) || (delta < -(1LL << 27)) || (delta >= (1LL << 27))) { return FAILURE; }
+        insn = (insn & 0xfc000000) | (static_cast<uint32_t>(delta >> 2) & 0x03ffffff);
+        writeLE(ptr, insn, 4);
+        return SUCCESS;
+    }
+    default :
+        return FAILURE;
+    }
+}
+
+bool RelocatableModule::getSymbolAddress(const std::string& name, uint64_t& address) const
+{
+    for (auto& symbol : m_symbols) {
+        if ((symbol.name != name) || ((symbol.info >> 4) == STB_LOCAL)) { continue; }
+        if ((symbol.shndx == SHN_UNDEF) || (symbol.shndx >= m_sections.size())) { continue; }
+        address = m_loadAddress + m_sections[symbol.shndx].imageOffset + symbol.value;
+        return true;
+    }
+    return false;
+}
+
+std::vector<uint64_t> RelocatableModule::getFunctionArray(uint32_t sectionType) const
+{
+    std::vector<uint64_t> functions;
+    if (m_image.empty()) { return functions; }
+    for (auto& section : m_sections) {
+        if ((section.type != sectionType) || !(section.flags & SHF_ALLOC)) { continue; }
+        for (uint64_t offset = 0; offset + 8 <= section.size; offset += 8) {
+            functions.push_back(readLE(m_image.data() + section.imageOffset + offset, 8));
+        }
+    }
+    return functions;
+}
+
+std::vector<uint64_t> RelocatableModule::getInitFunctions() const
+{
+    return getFunctionArray(SHT_INIT_ARRAY);
+}
+
+std::vector<uint64_t> RelocatableModule::getFiniFunctions() const
+{
+    // .fini_array runs last to first, the reverse of construction
+    std::vector<uint64_t> finiFunctions = getFunctionArray(SHT_FINI_ARRAY);
+    std::reverse(finiFunctions.begin(), finiFunctions.end());
+    return finiFunctions;
+}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace platform {
+
+// Loader for effect hot-load modules. A module is a partially linked (ld -r), position-independent
+// AArch64 ELF object built from the effect sources. Its relocations are resolved against the symbol
+// table of the running core (nm output of the kernel ELF). This does the same job as the loader on
+// the device, so it is used to validate a module before it is sent and to test modules on the host.
+class RelocatableModule {
+public:
+    RelocatableModule() = default;
+    virtual ~RelocatableModule() = default;
+
+    int  loadSymbolTable(const std::string& symbolFilePath);
+    void addCoreSymbol(const std::string& name, uint64_t address);
+
+    int loadModuleFile(const std::string& moduleFilePath);
+    int loadModule(const std::vector<uint8_t>& moduleData);
+
+    // Lay out the module at loadAddress and apply all relocations to produce the final image
+    int link(uint64_t loadAddress);
+
+    const std::vector<uint8_t>&     getImage() const { return m_image; }
+    const std::vector<std::string>& getUnresolvedSymbols() const { return m_unresolvedSymbols; }
+    bool getSymbolAddress(const std::string& name, uint64_t& address) const;
+    std::vector<uint64_t> getInitFunctions() const; // static constructors the loader must call after swap-in
+    std::vector<uint64_t> getFiniFunctions() const; // static destructors the loader must call before swap-out, in call order
+
+private:
+    struct Section {
+        std::string name;
+        uint32_t nameIndex = 0;
+        uint32_t type      = 0;
+        uint64_t flags     = 0;
+        uint64_t offset    = 0;   // file offset
+        uint64_t size      = 0;
+        uint32_t link      = 0;
+        uint32_t info      = 0;
+        uint64_t addralign = 0;
+        uint64_t entsize   = 0;
+        uint64_t imageOffset = 0; // offset in the linked image, allocated sections only
+    };
+
+    struct Symbol {
+        std::string name;
+        uint8_t  info   = 0;
+        uint16_t shndx  = 0;
+        uint64_t value  = 0;
+    };
+
+    std::vector<uint64_t> getFunctionArray(uint32_t sectionType) const;
+    int  resolveSymbol(uint32_t symbolIndex, uint64_t& address);
+    int  applyRelocation(uint32_t type, uint64_t place, uint64_t symbolAddress, int64_t addend,
+                         uint64_t gotAddress, uint64_t veneerAddress);
+
+    std::unordered_map<std::string, uint64_t> m_coreSymbols;
+    std::vector<uint8_t>     m_moduleData;
+    std::vector<Section>     m_sections;
+    std::vector<Symbol>      m_symbols;
+    std::vector<uint8_t>     m_image;
+    std::vector<std::string> m_unresolvedSymbols;
+    std::map<std::pair<uint32_t, int64_t>, uint64_t> m_gotEntries; // (symbol, addend) -> image offset
+    std::map<uint32_t, uint64_t> m_veneers;                         // symbol -> image offset
+    uint64_t m_loadAddress = 0;
+};
+
+}
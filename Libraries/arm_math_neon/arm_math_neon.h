@@ -0,0 +1,347 @@
+#pragma once
+
+// NEON kernels for the Cortex-A72 with the same signatures as the CMSIS-DSP functions they replace.
+// CMSIS-DSP targets Cortex-M, on aarch64 it falls back to generic C. Call the *_neon functions directly,
+// or define ARM_MATH_NEON_OVERRIDE before including this header to redirect the arm_* calls that follow.
+//
+// Intended accuracy compared to CMSIS-DSP:
+//  - add, sub, mult, scale, offset (f32) and all q15 functions are bit-exact
+//  - dot_prod, fir, biquad_cascade_df1 and cfft sum in a different order and use fused multiply-add,
+//    so results match to within normal float rounding (around 1e-6 relative to the signal level)
+//  - cfft with bitReverseFlag = 0 leaves the output in standard bit-reversed order
+// test/ checks these against scalar references. So far that has only run on the scalar fallback and on
+// x86-64 with the NEON intrinsics emulated, not yet on an aarch64 target or under qemu-user, and the
+// speedups have not been measured. Run "make test bench" in test/ there before relying on either.
+
+#include <stdint.h>
+#include "arm_math.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ARM_MATH_NEON_ENABLED 1
+#else
+#define ARM_MATH_NEON_ENABLED 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline q15_t arm_neon_sat_q15(int32_t value)
+{
+    if (value > INT16_MAX) { return INT16_MAX; }
+    if (value < INT16_MIN) { return INT16_MIN; }
+    return (q15_t)value;
+}
+
+/////////////////////
+// Basic math, f32
+/////////////////////
+static inline void arm_add_f32_neon(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 4 <= blockSize; i += 4) {
+        vst1q_f32(pDst + i, vaddq_f32(vld1q_f32(pSrcA + i), vld1q_f32(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = pSrcA[i] + pSrcB[i]; }
+}
+
+static inline void arm_sub_f32_neon(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 4 <= blockSize; i += 4) {
+        vst1q_f32(pDst + i, vsubq_f32(vld1q_f32(pSrcA + i), vld1q_f32(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = pSrcA[i] - pSrcB[i]; }
+}
+
+static inline void arm_mult_f32_neon(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 4 <= blockSize; i += 4) {
+        vst1q_f32(pDst + i, vmulq_f32(vld1q_f32(pSrcA + i), vld1q_f32(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = pSrcA[i] * pSrcB[i]; }
+}
+
+static inline void arm_scale_f32_neon(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 4 <= blockSize; i += 4) {
+        vst1q_f32(pDst + i, vmulq_n_f32(vld1q_f32(pSrc + i), scale));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = pSrc[i] * scale; }
+}
+
+static inline void arm_offset_f32_neon(const float32_t* pSrc, float32_t offset, float32_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    float32x4_t vOffset = vdupq_n_f32(offset);
+    for (; i + 4 <= blockSize; i += 4) {
+        vst1q_f32(pDst + i, vaddq_f32(vld1q_f32(pSrc + i), vOffset));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = pSrc[i] + offset; }
+}
+
+static inline void arm_dot_prod_f32_neon(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result)
+{
+    uint32_t i = 0;
+    float32_t sum = 0.0f;
+#if ARM_MATH_NEON_ENABLED
+    // two accumulators to hide the FMA latency
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    for (; i + 8 <= blockSize; i += 8) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(pSrcA + i),     vld1q_f32(pSrcB + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(pSrcA + i + 4), vld1q_f32(pSrcB + i + 4));
+    }
+    sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+#endif
+    for (; i < blockSize; i++) { sum += pSrcA[i] * pSrcB[i]; }
+    *result = sum;
+}
+
+/////////////////////
+// Basic math, q15
+/////////////////////
+static inline void arm_add_q15_neon(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 8 <= blockSize; i += 8) {
+        vst1q_s16(pDst + i, vqaddq_s16(vld1q_s16(pSrcA + i), vld1q_s16(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = arm_neon_sat_q15((int32_t)pSrcA[i] + pSrcB[i]); }
+}
+
+static inline void arm_sub_q15_neon(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    for (; i + 8 <= blockSize; i += 8) {
+        vst1q_s16(pDst + i, vqsubq_s16(vld1q_s16(pSrcA + i), vld1q_s16(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = arm_neon_sat_q15((int32_t)pSrcA[i] - pSrcB[i]); }
+}
+
+static inline void arm_mult_q15_neon(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+#if ARM_MATH_NEON_ENABLED
+    // saturating doubling multiply high is (a*b) >> 15 with saturation, same as CMSIS
+    for (; i + 8 <= blockSize; i += 8) {
+        vst1q_s16(pDst + i, vqdmulhq_s16(vld1q_s16(pSrcA + i), vld1q_s16(pSrcB + i)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = arm_neon_sat_q15(((int32_t)pSrcA[i] * pSrcB[i]) >> 15); }
+}
+
+static inline void arm_scale_q15_neon(const q15_t* pSrc, q15_t scaleFract, int8_t shift, q15_t* pDst, uint32_t blockSize)
+{
+    uint32_t i = 0;
+    int32_t kShift = 15 - shift;
+#if ARM_MATH_NEON_ENABLED
+    int16x4_t vScale = vdup_n_s16(scaleFract);
+    int32x4_t vShift = vdupq_n_s32(-kShift); // negative shift is an arithmetic right shift
+    for (; i + 8 <= blockSize; i += 8) {
+        int16x8_t in = vld1q_s16(pSrc + i);
+        int32x4_t lo = vshlq_s32(vmull_s16(vget_low_s16(in),  vScale), vShift);
+        int32x4_t hi = vshlq_s32(vmull_s16(vget_high_s16(in), vScale), vShift);
+        vst1q_s16(pDst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+#endif
+    for (; i < blockSize; i++) { pDst[i] = arm_neon_sat_q15(((int32_t)pSrc[i] * scaleFract) >> kShift); }
+}
+
+/////////////////////
+// Filters
+/////////////////////
+static inline void arm_fir_f32_neon(const arm_fir_instance_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize)
+{
+    // Same state layout as CMSIS, numTaps-1 previous samples followed by the new block
+    float32_t* pState = S->pState;
+    const float32_t* pCoeffs = S->pCoeffs;
+    const uint32_t numTaps = S->numTaps;
+
+    for (uint32_t i = 0; i < blockSize; i++) { pState[numTaps - 1 + i] = pSrc[i]; }
+
+    uint32_t n = 0;
+#if ARM_MATH_NEON_ENABLED
+    // four outputs at a time, each tap is one FMA across the four
+    for (; n + 4 <= blockSize; n += 4) {
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        for (uint32_t k = 0; k < numTaps; k++) {
+            acc = vfmaq_n_f32(acc, vld1q_f32(pState + n + k), pCoeffs[k]);
+        }
+        vst1q_f32(pDst + n, acc);
+    }
+#endif
+    for (; n < blockSize; n++) {
+        float32_t acc = 0.0f;
+        for (uint32_t k = 0; k < numTaps; k++) { acc += pCoeffs[k] * pState[n + k]; }
+        pDst[n] = acc;
+    }
+
+    for (uint32_t i = 0; i < numTaps - 1; i++) { pState[i] = pState[blockSize + i]; }
+}
+
+static inline void arm_biquad_cascade_df1_f32_neon(const arm_biquad_casd_df1_inst_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize)
+{
+    // The feed-forward half of each stage has no recursion so it is vectorized over the block,
+    // which leaves only two multiply-adds per sample in the serial feedback path.
+    enum { CHUNK_SIZE = 64 };
+    float32_t xBuf[CHUNK_SIZE + 2]; // x[n-2], x[n-1], x[n] ...
+    float32_t ffBuf[CHUNK_SIZE];
+
+    const float32_t* pIn = pSrc;
+    float32_t* pState = S->pState;
+    const float32_t* pCoeffs = S->pCoeffs;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++) {
+        const float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];
+        const float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+        float32_t xn1 = pState[0], xn2 = pState[1], yn1 = pState[2], yn2 = pState[3];
+
+        for (uint32_t offset = 0; offset < blockSize; offset += CHUNK_SIZE) {
+            uint32_t chunkSize = (blockSize - offset < CHUNK_SIZE) ? (blockSize - offset) : CHUNK_SIZE;
+            xBuf[0] = xn2;
+            xBuf[1] = xn1;
+            for (uint32_t i = 0; i < chunkSize; i++) { xBuf[i + 2] = pIn[offset + i]; }
+
+            uint32_t n = 0;
+#if ARM_MATH_NEON_ENABLED
+            for (; n + 4 <= chunkSize; n += 4) {
+                float32x4_t ff = vmulq_n_f32(vld1q_f32(xBuf + n + 2), b0);
+                ff = vfmaq_n_f32(ff, vld1q_f32(xBuf + n + 1), b1);
+                ff = vfmaq_n_f32(ff, vld1q_f32(xBuf + n),     b2);
+                vst1q_f32(ffBuf + n, ff);
+            }
+#endif
+            for (; n < chunkSize; n++) { ffBuf[n] = b0 * xBuf[n + 2] + b1 * xBuf[n + 1] + b2 * xBuf[n]; }
+
+            for (n = 0; n < chunkSize; n++) {
+                float32_t yn = ffBuf[n] + a1 * yn1 + a2 * yn2;
+                yn2 = yn1;
+                yn1 = yn;
+                pDst[offset + n] = yn;
+            }
+            xn1 = xBuf[chunkSize + 1];
+            xn2 = xBuf[chunkSize];
+        }
+
+        pState[0] = xn1; pState[1] = xn2; pState[2] = yn1; pState[3] = yn2;
+        pState  += 4;
+        pCoeffs += 5;
+        pIn = pDst; // later stages work in place on the output
+    }
+}
+
+/////////////////////
+// Transforms
+/////////////////////
+static inline void arm_cfft_f32_neon(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+    // Radix-2 decimation in frequency using the CMSIS twiddle table (cos, sin pairs for k = 0 .. 3N/4).
+    // Forward uses W = cos - j*sin, inverse uses the conjugate and scales by 1/N like CMSIS.
+    const uint32_t fftLen = S->fftLen;
+    const float32_t* pTwiddle = S->pTwiddle;
+    const float32_t sinSign = ifftFlag ? -1.0f : 1.0f;
+
+    for (uint32_t m = fftLen; m >= 2; m >>= 1) {
+        const uint32_t half = m >> 1;
+        const uint32_t twiddleStride = fftLen / m;
+
+        uint32_t j = 0;
+#if ARM_MATH_NEON_ENABLED
+        for (; j + 4 <= half; j += 4) {
+            float32_t wr[4], wi[4];
+            for (uint32_t k = 0; k < 4; k++) {
+                wr[k] = pTwiddle[2 * (j + k) * twiddleStride];
+                wi[k] = sinSign * pTwiddle[2 * (j + k) * twiddleStride + 1];
+            }
+            const float32x4_t vwr = vld1q_f32(wr);
+            const float32x4_t vwi = vld1q_f32(wi);
+
+            for (uint32_t group = 0; group < fftLen; group += m) {
+                float32_t* pA = p1 + 2 * (group + j);
+                float32_t* pB = pA + 2 * half;
+                float32x4x2_t a = vld2q_f32(pA);
+                float32x4x2_t b = vld2q_f32(pB);
+                float32x4x2_t sum, product;
+                sum.val[0] = vaddq_f32(a.val[0], b.val[0]);
+                sum.val[1] = vaddq_f32(a.val[1], b.val[1]);
+                float32x4_t dr = vsubq_f32(a.val[0], b.val[0]);
+                float32x4_t di = vsubq_f32(a.val[1], b.val[1]);
+                // (dr + j*di) * (wr - j*wi)
+                product.val[0] = vfmaq_f32(vmulq_f32(dr, vwr), di, vwi);
+                product.val[1] = vfmsq_f32(vmulq_f32(di, vwr), dr, vwi);
+                vst2q_f32(pA, sum);
+                vst2q_f32(pB, product);
+            }
+        }
+#endif
+        for (; j < half; j++) {
+            const float32_t wr = pTwiddle[2 * j * twiddleStride];
+            const float32_t wi = sinSign * pTwiddle[2 * j * twiddleStride + 1];
+            for (uint32_t group = 0; group < fftLen; group += m) {
+                float32_t* pA = p1 + 2 * (group + j);
+                float32_t* pB = pA + 2 * half;
+                float32_t dr = pA[0] - pB[0];
+                float32_t di = pA[1] - pB[1];
+                pA[0] += pB[0];
+                pA[1] += pB[1];
+                pB[0] = dr * wr + di * wi;
+                pB[1] = di * wr - dr * wi;
+            }
+        }
+    }
+
+    if (bitReverseFlag) {
+        for (uint32_t i = 1, j = 0; i < fftLen; i++) {
+            uint32_t bit = fftLen >> 1;
+            for (; j & bit; bit >>= 1) { j ^= bit; }
+            j ^= bit;
+            if (i < j) {
+                float32_t re = p1[2 * i], im = p1[2 * i + 1];
+                p1[2 * i] = p1[2 * j];
+                p1[2 * i + 1] = p1[2 * j + 1];
+                p1[2 * j] = re;
+                p1[2 * j + 1] = im;
+            }
+        }
+    }
+
+    if (ifftFlag) { arm_scale_f32_neon(p1, 1.0f / fftLen, p1, 2 * fftLen); }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(ARM_MATH_NEON_OVERRIDE)
+#define arm_add_f32                arm_add_f32_neon
+#define arm_sub_f32                arm_sub_f32_neon
+#define arm_mult_f32               arm_mult_f32_neon
+#define arm_scale_f32              arm_scale_f32_neon
+#define arm_offset_f32             arm_offset_f32_neon
+#define arm_dot_prod_f32           arm_dot_prod_f32_neon
+#define arm_add_q15                arm_add_q15_neon
+#define arm_sub_q15                arm_sub_q15_neon
+#define arm_mult_q15               arm_mult_q15_neon
+#define arm_scale_q15              arm_scale_q15_neon
+#define arm_fir_f32                arm_fir_f32_neon
+#define arm_biquad_cascade_df1_f32 arm_biquad_cascade_df1_f32_neon
+#define arm_cfft_f32               arm_cfft_f32_neon
+#endif
@@ -0,0 +1,141 @@
+// Per-kernel speedup of arm_math_neon over the scalar reference (reference.cpp, built without
+// auto-vectorization). Block sizes are AUDIO_BLOCK_SAMPLES (128) and a larger block, FFT sizes are
+// typical effect sizes. Each result is the median of several timed batches.
+//
+// Run on an aarch64 host or under qemu-user. Timings under emulation only show relative trends.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "arm_math_neon.h"
+#include "reference.h"
+
+static const uint32_t BLOCK_SIZES[] = { 128, 1024 };
+static const uint32_t FFT_SIZES[]   = { 256, 1024, 4096 };
+static const unsigned NUM_BATCHES   = 7;
+static const double   MIN_BATCH_SECONDS = 0.01;
+
+static volatile float g_sink; // keeps the results alive
+
+// Nanoseconds per call, median over the batches. The batch size is calibrated so each batch takes MIN_BATCH_SECONDS.
+static double timeKernel(const std::function<void()>& kernel)
+{
+    using Clock = std::chrono::steady_clock;
+    unsigned callsPerBatch = 1;
+    while (true) {
+        auto startTime = Clock::now();
+        for (unsigned i = 0; i < callsPerBatch; i++) { kernel(); }
+        double seconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+        if ((seconds >= MIN_BATCH_SECONDS) || (callsPerBatch >= (1u << 30))) { break; }
+        callsPerBatch *= 2;
+    }
+
+    std::vector<double> nsPerCall;
+    for (unsigned batch = 0; batch < NUM_BATCHES; batch++) {
+        auto startTime = Clock::now();
+        for (unsigned i = 0; i < callsPerBatch; i++) { kernel(); }
+        nsPerCall.push_back(std::chrono::duration<double, std::nano>(Clock::now() - startTime).count() / callsPerBatch);
+    }
+    std::sort(nsPerCall.begin(), nsPerCall.end());
+    return nsPerCall[nsPerCall.size() / 2];
+}
+
+static void report(const std::string& kernel, uint32_t size, const std::function<void()>& neonKernel,
+    const std::function<void()>& scalarKernel)
+{
+    double scalarNs = timeKernel(scalarKernel);
+    double neonNs   = timeKernel(neonKernel);
+    printf("%-28s %6u %12.1f %12.1f %8.2fx\n", kernel.c_str(), size, scalarNs, neonNs, scalarNs / neonNs);
+}
+
+static std::vector<float> makeSignal(uint32_t count, float frequency)
+{
+    std::vector<float> signal(count);
+    for (uint32_t i = 0; i < count; i++) { signal[i] = 0.5f * std::sin(frequency * i); }
+    return signal;
+}
+
+int main()
+{
+    printf("arm_math_neon_bench: NEON path %s\n", ARM_MATH_NEON_ENABLED ? "enabled" : "disabled, both columns are scalar");
+    printf("%-28s %6s %12s %12s %9s\n", "kernel", "size", "scalar ns", "neon ns", "speedup");
+
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<float> a = makeSignal(blockSize, 0.01f), b = makeSignal(blockSize, 0.03f), dst(blockSize);
+        std::vector<q15_t> qa(blockSize), qb(blockSize), qdst(blockSize);
+        for (uint32_t i = 0; i < blockSize; i++) { qa[i] = (q15_t)(a[i] * 32767); qb[i] = (q15_t)(b[i] * 32767); }
+
+        report("arm_add_f32", blockSize,
+            [&]() { arm_add_f32_neon(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; },
+            [&]() { ref_add_f32(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; });
+        report("arm_sub_f32", blockSize,
+            [&]() { arm_sub_f32_neon(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; },
+            [&]() { ref_sub_f32(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; });
+        report("arm_mult_f32", blockSize,
+            [&]() { arm_mult_f32_neon(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; },
+            [&]() { ref_mult_f32(a.data(), b.data(), dst.data(), blockSize); g_sink = dst[0]; });
+        report("arm_scale_f32", blockSize,
+            [&]() { arm_scale_f32_neon(a.data(), 0.5f, dst.data(), blockSize); g_sink = dst[0]; },
+            [&]() { ref_scale_f32(a.data(), 0.5f, dst.data(), blockSize); g_sink = dst[0]; });
+        report("arm_offset_f32", blockSize,
+            [&]() { arm_offset_f32_neon(a.data(), 0.5f, dst.data(), blockSize); g_sink = dst[0]; },
+            [&]() { ref_offset_f32(a.data(), 0.5f, dst.data(), blockSize); g_sink = dst[0]; });
+        report("arm_dot_prod_f32", blockSize,
+            [&]() { float result; arm_dot_prod_f32_neon(a.data(), b.data(), blockSize, &result); g_sink = result; },
+            [&]() { float result; ref_dot_prod_f32(a.data(), b.data(), blockSize, &result); g_sink = result; });
+
+        report("arm_add_q15", blockSize,
+            [&]() { arm_add_q15_neon(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; },
+            [&]() { ref_add_q15(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; });
+        report("arm_sub_q15", blockSize,
+            [&]() { arm_sub_q15_neon(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; },
+            [&]() { ref_sub_q15(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; });
+        report("arm_mult_q15", blockSize,
+            [&]() { arm_mult_q15_neon(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; },
+            [&]() { ref_mult_q15(qa.data(), qb.data(), qdst.data(), blockSize); g_sink = qdst[0]; });
+        report("arm_scale_q15", blockSize,
+            [&]() { arm_scale_q15_neon(qa.data(), 16384, 1, qdst.data(), blockSize); g_sink = qdst[0]; },
+            [&]() { ref_scale_q15(qa.data(), 16384, 1, qdst.data(), blockSize); g_sink = qdst[0]; });
+
+        for (uint16_t numTaps : { 16, 64 }) {
+            std::vector<float> coeffs = makeSignal(numTaps, 0.2f);
+            std::vector<float> state(numTaps + blockSize - 1, 0.0f);
+            arm_fir_instance_f32 fir = { numTaps, state.data(), coeffs.data() };
+            report("arm_fir_f32 " + std::to_string(numTaps) + " taps", blockSize,
+                [&]() { arm_fir_f32_neon(&fir, a.data(), dst.data(), blockSize); g_sink = dst[0]; },
+                [&]() { ref_fir_f32(&fir, a.data(), dst.data(), blockSize); g_sink = dst[0]; });
+        }
+
+        for (uint32_t numStages : { 1, 4 }) {
+            std::vector<float> coeffs;
+            for (uint32_t stage = 0; stage < numStages; stage++) {
+                coeffs.insert(coeffs.end(), { 0.0200834f, 0.0401667f, 0.0200834f, 1.5610181f, -0.6413515f });
+            }
+            std::vector<float> state(4 * numStages, 0.0f);
+            arm_biquad_casd_df1_inst_f32 biquad = { numStages, state.data(), coeffs.data() };
+            report("arm_biquad_df1_f32 " + std::to_string(numStages) + " stg", blockSize,
+                [&]() { arm_biquad_cascade_df1_f32_neon(&biquad, a.data(), dst.data(), blockSize); g_sink = dst[0]; },
+                [&]() { ref_biquad_cascade_df1_f32(&biquad, a.data(), dst.data(), blockSize); g_sink = dst[0]; });
+        }
+    }
+
+    for (auto fftLen : FFT_SIZES) {
+        std::vector<float> twiddle(2 * (3 * fftLen / 4));
+        for (uint32_t k = 0; k < 3 * fftLen / 4; k++) {
+            twiddle[2 * k]     = (float)std::cos(2.0 * 3.14159265358979323846 * k / fftLen);
+            twiddle[2 * k + 1] = (float)std::sin(2.0 * 3.14159265358979323846 * k / fftLen);
+        }
+        arm_cfft_instance_f32 fft = { (uint16_t)fftLen, twiddle.data(), nullptr, 0 };
+        std::vector<float> input = makeSignal(2 * fftLen, 0.05f), buffer(2 * fftLen);
+
+        // the copy is part of both timings so the transform always sees the same input
+        report("arm_cfft_f32", fftLen,
+            [&]() { std::copy(input.begin(), input.end(), buffer.begin()); arm_cfft_f32_neon(&fft, buffer.data(), 0, 1); g_sink = buffer[0]; },
+            [&]() { std::copy(input.begin(), input.end(), buffer.begin()); ref_cfft_f32(&fft, buffer.data(), 0, 1); g_sink = buffer[0]; });
+    }
+    return 0;
+}
@@ -0,0 +1,332 @@
+// Bit-exactness and tolerance test for arm_math_neon. Every kernel is compared against the scalar
+// reference (reference.cpp) and, where the results are not bit-exact, against a double precision result.
+// Block sizes cover the vector widths (4 for f32, 8 for q15), their remainders and the biquad chunk size.
+//
+// On an aarch64 host (or under qemu-user) this checks the NEON path, elsewhere it checks the scalar fallback.
+#include <cfloat>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "arm_math_neon.h"
+#include "reference.h"
+
+static const uint32_t BLOCK_SIZES[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 63, 64, 65, 128, 131, 150 };
+static const double   PI = 3.14159265358979323846;
+
+static unsigned g_checks   = 0;
+static unsigned g_failures = 0;
+
+static void check(bool condition, const std::string& kernel, uint32_t size, const std::string& detail = "")
+{
+    g_checks++;
+    if (!condition) {
+        printf("FAIL: %s size=%u %s\n", kernel.c_str(), size, detail.c_str());
+        g_failures++;
+    }
+}
+
+// xorshift32, so every host sees the same inputs
+static uint32_t g_randomState = 0x2545f491;
+static uint32_t nextRandom()
+{
+    g_randomState ^= g_randomState << 13;
+    g_randomState ^= g_randomState >> 17;
+    g_randomState ^= g_randomState << 5;
+    return g_randomState;
+}
+
+static float randomFloat() { return (nextRandom() >> 8) * (2.0f / 16777216.0f) - 1.0f; } // [-1, 1)
+static q15_t randomQ15()   { return (q15_t)(nextRandom() >> 16); }
+
+static std::vector<float> randomFloats(size_t count)
+{
+    std::vector<float> values(count);
+    for (auto& value : values) { value = randomFloat(); }
+    return values;
+}
+
+static std::vector<q15_t> randomQ15s(size_t count)
+{
+    std::vector<q15_t> values(count);
+    for (auto& value : values) { value = randomQ15(); }
+    // make sure the saturating edge cases are hit
+    if (count > 0) { values[0] = INT16_MIN; }
+    if (count > 1) { values[count - 1] = INT16_MAX; }
+    return values;
+}
+
+static bool bitExact(const std::vector<float>& a, const std::vector<float>& b)
+{
+    return (a.size() == b.size()) && (std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+}
+
+static double maxError(const std::vector<float>& a, const std::vector<double>& b)
+{
+    double error = 0.0;
+    for (size_t i = 0; i < a.size(); i++) { error = std::fmax(error, std::fabs(a[i] - b[i])); }
+    return error;
+}
+
+static std::string errorDetail(double error, double tolerance)
+{
+    char detail[64];
+    snprintf(detail, sizeof(detail), "error=%g tolerance=%g", error, tolerance);
+    return detail;
+}
+
+/////////////////////
+// Basic math
+/////////////////////
+typedef void (*BinaryF32)(const float32_t*, const float32_t*, float32_t*, uint32_t);
+typedef void (*BinaryQ15)(const q15_t*, const q15_t*, q15_t*, uint32_t);
+
+static void testBinaryF32(const char* kernel, BinaryF32 neonKernel, BinaryF32 refKernel)
+{
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<float> a = randomFloats(blockSize), b = randomFloats(blockSize);
+        std::vector<float> neon(blockSize), ref(blockSize);
+        neonKernel(a.data(), b.data(), neon.data(), blockSize);
+        refKernel(a.data(), b.data(), ref.data(), blockSize);
+        check(bitExact(neon, ref), kernel, blockSize, "not bit-exact");
+    }
+}
+
+static void testBinaryQ15(const char* kernel, BinaryQ15 neonKernel, BinaryQ15 refKernel)
+{
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<q15_t> a = randomQ15s(blockSize), b = randomQ15s(blockSize);
+        std::vector<q15_t> neon(blockSize), ref(blockSize);
+        neonKernel(a.data(), b.data(), neon.data(), blockSize);
+        refKernel(a.data(), b.data(), ref.data(), blockSize);
+        check(neon == ref, kernel, blockSize, "not bit-exact");
+    }
+}
+
+static void testBasicMath()
+{
+    testBinaryF32("arm_add_f32",  arm_add_f32_neon,  ref_add_f32);
+    testBinaryF32("arm_sub_f32",  arm_sub_f32_neon,  ref_sub_f32);
+    testBinaryF32("arm_mult_f32", arm_mult_f32_neon, ref_mult_f32);
+    testBinaryQ15("arm_add_q15",  arm_add_q15_neon,  ref_add_q15);
+    testBinaryQ15("arm_sub_q15",  arm_sub_q15_neon,  ref_sub_q15);
+    testBinaryQ15("arm_mult_q15", arm_mult_q15_neon, ref_mult_q15);
+
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<float> src = randomFloats(blockSize);
+        std::vector<float> neon(blockSize), ref(blockSize);
+        arm_scale_f32_neon(src.data(), 0.7071f, neon.data(), blockSize);
+        ref_scale_f32(src.data(), 0.7071f, ref.data(), blockSize);
+        check(bitExact(neon, ref), "arm_scale_f32", blockSize, "not bit-exact");
+
+        arm_offset_f32_neon(src.data(), -0.25f, neon.data(), blockSize);
+        ref_offset_f32(src.data(), -0.25f, ref.data(), blockSize);
+        check(bitExact(neon, ref), "arm_offset_f32", blockSize, "not bit-exact");
+
+        // in place, as effects usually call it
+        std::vector<float> inPlace = src;
+        arm_scale_f32_neon(inPlace.data(), 0.7071f, inPlace.data(), blockSize);
+        ref_scale_f32(src.data(), 0.7071f, ref.data(), blockSize);
+        check(bitExact(inPlace, ref), "arm_scale_f32 in place", blockSize, "not bit-exact");
+    }
+
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<q15_t> src = randomQ15s(blockSize);
+        for (int shift = -3; shift <= 3; shift++) {
+            for (q15_t scaleFract : { (q15_t)INT16_MIN, (q15_t)-12345, (q15_t)16384, (q15_t)INT16_MAX }) {
+                std::vector<q15_t> neon(blockSize), ref(blockSize);
+                arm_scale_q15_neon(src.data(), scaleFract, (int8_t)shift, neon.data(), blockSize);
+                ref_scale_q15(src.data(), scaleFract, (int8_t)shift, ref.data(), blockSize);
+                check(neon == ref, "arm_scale_q15", blockSize, "not bit-exact, shift=" + std::to_string(shift) +
+                    " scaleFract=" + std::to_string(scaleFract));
+            }
+        }
+    }
+
+    // The NEON dot product sums in a different order, so compare to the exact sum
+    for (auto blockSize : BLOCK_SIZES) {
+        std::vector<float> a = randomFloats(blockSize), b = randomFloats(blockSize);
+        double exact = 0.0, magnitude = 0.0;
+        for (uint32_t i = 0; i < blockSize; i++) {
+            exact     += (double)a[i] * b[i];
+            magnitude += std::fabs((double)a[i] * b[i]);
+        }
+        float neon = 0.0f, ref = 0.0f;
+        arm_dot_prod_f32_neon(a.data(), b.data(), blockSize, &neon);
+        ref_dot_prod_f32(a.data(), b.data(), blockSize, &ref);
+        double tolerance = 2.0 * blockSize * FLT_EPSILON * magnitude + 1e-30;
+        check(std::fabs(neon - exact) <= tolerance, "arm_dot_prod_f32", blockSize, errorDetail(std::fabs(neon - exact), tolerance));
+        check(std::fabs(ref - exact) <= tolerance, "ref_dot_prod_f32", blockSize, errorDetail(std::fabs(ref - exact), tolerance));
+    }
+}
+
+/////////////////////
+// Filters
+/////////////////////
+static void testFir()
+{
+    const uint32_t NUM_CALLS = 3; // the state has to carry over between blocks
+    for (uint16_t numTaps : { 1, 2, 3, 5, 8, 29, 64 }) {
+        for (auto blockSize : BLOCK_SIZES) {
+            std::vector<float> coeffs = randomFloats(numTaps);
+            std::vector<float> input  = randomFloats(NUM_CALLS * blockSize);
+            std::vector<float> neonState(numTaps + blockSize - 1, 0.0f), refState(numTaps + blockSize - 1, 0.0f);
+            std::vector<float> neon(input.size()), ref(input.size());
+            arm_fir_instance_f32 neonFir = { numTaps, neonState.data(), coeffs.data() };
+            arm_fir_instance_f32 refFir  = { numTaps, refState.data(),  coeffs.data() };
+            for (uint32_t call = 0; call < NUM_CALLS; call++) {
+                arm_fir_f32_neon(&neonFir, input.data() + call * blockSize, neon.data() + call * blockSize, blockSize);
+                ref_fir_f32(&refFir, input.data() + call * blockSize, ref.data() + call * blockSize, blockSize);
+            }
+
+            // CMSIS stores the coefficients time reversed, y[n] = sum(coeffs[k] * x[n - (numTaps-1) + k])
+            std::vector<double> exact(input.size(), 0.0);
+            double coeffSum = 0.0;
+            for (auto coeff : coeffs) { coeffSum += std::fabs(coeff); }
+            for (size_t n = 0; n < input.size(); n++) {
+                for (uint32_t k = 0; k < numTaps; k++) {
+                    long index = (long)n - (numTaps - 1) + k;
+                    if (index >= 0) { exact[n] += (double)coeffs[k] * input[index]; }
+                }
+            }
+            double tolerance = 2.0 * numTaps * FLT_EPSILON * coeffSum;
+            std::string kernel = "arm_fir_f32 numTaps=" + std::to_string(numTaps);
+            check(maxError(neon, exact) <= tolerance, kernel, blockSize, errorDetail(maxError(neon, exact), tolerance));
+            check(maxError(ref, exact) <= tolerance, "ref_fir_f32", blockSize, errorDetail(maxError(ref, exact), tolerance));
+        }
+    }
+}
+
+static void testBiquad()
+{
+    const uint32_t NUM_CALLS = 3;
+    // A lowpass, a peaking and a highpass section, already in the CMSIS form with a1/a2 negated
+    const float COEFFS[] = {
+        0.0200834f,  0.0401667f, 0.0200834f,  1.5610181f, -0.6413515f,
+        1.0520385f, -1.8532700f, 0.8199130f,  1.8532700f, -0.8719515f,
+        0.8005924f, -1.6011847f, 0.8005924f,  1.5610181f, -0.6413515f,
+    };
+
+    for (uint32_t numStages = 1; numStages <= 3; numStages++) {
+        for (auto blockSize : BLOCK_SIZES) {
+            std::vector<float> input = randomFloats(NUM_CALLS * blockSize);
+            std::vector<float> neonState(4 * numStages, 0.0f), refState(4 * numStages, 0.0f);
+            std::vector<float> neon(input.size()), ref(input.size());
+            arm_biquad_casd_df1_inst_f32 neonBiquad = { numStages, neonState.data(), COEFFS };
+            arm_biquad_casd_df1_inst_f32 refBiquad  = { numStages, refState.data(),  COEFFS };
+
+            // in place for the NEON kernel, separate buffers for the reference
+            neon = input;
+            for (uint32_t call = 0; call < NUM_CALLS; call++) {
+                float* pBlock = neon.data() + call * blockSize;
+                arm_biquad_cascade_df1_f32_neon(&neonBiquad, pBlock, pBlock, blockSize);
+                ref_biquad_cascade_df1_f32(&refBiquad, input.data() + call * blockSize, ref.data() + call * blockSize, blockSize);
+            }
+
+            std::vector<double> exact(input.begin(), input.end());
+            for (uint32_t stage = 0; stage < numStages; stage++) {
+                const float* k = COEFFS + 5 * stage;
+                double xn1 = 0, xn2 = 0, yn1 = 0, yn2 = 0;
+                for (auto& sample : exact) {
+                    double yn = k[0] * sample + k[1] * xn1 + k[2] * xn2 + k[3] * yn1 + k[4] * yn2;
+                    xn2 = xn1; xn1 = sample;
+                    yn2 = yn1; yn1 = yn;
+                    sample = yn;
+                }
+            }
+
+            const double tolerance = 1e-5 * numStages;
+            std::string kernel = "arm_biquad_cascade_df1_f32 numStages=" + std::to_string(numStages);
+            check(maxError(neon, exact) <= tolerance, kernel, blockSize, errorDetail(maxError(neon, exact), tolerance));
+            check(maxError(ref, exact) <= tolerance, "ref_biquad_cascade_df1_f32", blockSize, errorDetail(maxError(ref, exact), tolerance));
+            std::vector<double> refStateD(refState.begin(), refState.end());
+            check(maxError(neonState, refStateD) <= tolerance, kernel + " state", blockSize);
+        }
+    }
+}
+
+/////////////////////
+// Transforms
+/////////////////////
+static std::vector<float> makeTwiddle(uint32_t fftLen)
+{
+    // same layout as the CMSIS twiddleCoef tables, cos/sin pairs for k = 0 .. 3N/4
+    std::vector<float> twiddle(2 * (3 * fftLen / 4));
+    for (uint32_t k = 0; k < 3 * fftLen / 4; k++) {
+        twiddle[2 * k]     = (float)std::cos(2.0 * PI * k / fftLen);
+        twiddle[2 * k + 1] = (float)std::sin(2.0 * PI * k / fftLen);
+    }
+    return twiddle;
+}
+
+static uint32_t bitReverse(uint32_t index, uint32_t fftLen)
+{
+    uint32_t reversed = 0;
+    for (uint32_t bit = 1; bit < fftLen; bit <<= 1) {
+        reversed = (reversed << 1) | ((index & bit) ? 1 : 0);
+    }
+    return reversed;
+}
+
+static void testCfft()
+{
+    for (uint32_t fftLen = 16; fftLen <= 4096; fftLen <<= 1) {
+        std::vector<float> twiddle = makeTwiddle(fftLen);
+        arm_cfft_instance_f32 fft = { (uint16_t)fftLen, twiddle.data(), nullptr, 0 };
+        std::vector<float> input = randomFloats(2 * fftLen);
+        const double log2Len = std::log2((double)fftLen);
+
+        // forward, against a double precision DFT
+        std::vector<std::complex<double>> roots(fftLen);
+        for (uint32_t k = 0; k < fftLen; k++) { roots[k] = std::polar(1.0, -2.0 * PI * k / fftLen); }
+        std::vector<double> exact(2 * fftLen);
+        for (uint32_t k = 0; k < fftLen; k++) {
+            std::complex<double> sum = 0.0;
+            for (uint32_t n = 0; n < fftLen; n++) {
+                sum += std::complex<double>(input[2 * n], input[2 * n + 1]) * roots[((uint64_t)n * k) % fftLen];
+            }
+            exact[2 * k]     = sum.real();
+            exact[2 * k + 1] = sum.imag();
+        }
+
+        std::vector<float> neon = input, ref = input;
+        arm_cfft_f32_neon(&fft, neon.data(), 0, 1);
+        ref_cfft_f32(&fft, ref.data(), 0, 1);
+        double tolerance = 4.0 * FLT_EPSILON * log2Len * std::sqrt((double)fftLen);
+        check(maxError(neon, exact) <= tolerance, "arm_cfft_f32 forward", fftLen, errorDetail(maxError(neon, exact), tolerance));
+        check(maxError(ref, exact) <= tolerance, "ref_cfft_f32 forward", fftLen, errorDetail(maxError(ref, exact), tolerance));
+
+        // without bit reversal the output is in bit-reversed order
+        std::vector<float> unordered = input;
+        arm_cfft_f32_neon(&fft, unordered.data(), 0, 0);
+        bool isBitReversed = true;
+        for (uint32_t k = 0; k < fftLen; k++) {
+            uint32_t r = bitReverse(k, fftLen);
+            isBitReversed = isBitReversed && (unordered[2 * r] == neon[2 * k]) && (unordered[2 * r + 1] == neon[2 * k + 1]);
+        }
+        check(isBitReversed, "arm_cfft_f32 bitReverseFlag=0", fftLen, "output not in bit-reversed order");
+
+        // inverse brings the input back, including the 1/N scaling
+        arm_cfft_f32_neon(&fft, neon.data(), 1, 1);
+        std::vector<double> original(input.begin(), input.end());
+        double inverseTolerance = 4.0 * FLT_EPSILON * log2Len;
+        check(maxError(neon, original) <= inverseTolerance, "arm_cfft_f32 inverse", fftLen,
+            errorDetail(maxError(neon, original), inverseTolerance));
+    }
+}
+
+int main()
+{
+    printf("arm_math_neon_test: NEON path %s\n", ARM_MATH_NEON_ENABLED ? "enabled" : "disabled, testing the scalar fallback");
+
+    testBasicMath();
+    testFir();
+    testBiquad();
+    testCfft();
+
+    printf("arm_math_neon_test: %u checks, %u failures\n", g_checks, g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// The CMSIS-DSP types used by arm_math_neon.h, so the test and benchmark build on any host without
+// CMSIS-DSP. The layouts match CMSIS-DSP 1.x. Build with CMSIS_INCLUDE=<path> to use the real header.
+
+#include <stdint.h>
+
+typedef float   float32_t;
+typedef int16_t q15_t;
+
+typedef struct {
+    uint16_t numTaps;
+    float32_t* pState;
+    const float32_t* pCoeffs;
+} arm_fir_instance_f32;
+
+typedef struct {
+    uint32_t numStages;
+    float32_t* pState;
+    const float32_t* pCoeffs;
+} arm_biquad_casd_df1_inst_f32;
+
+typedef struct {
+    uint16_t fftLen;
+    const float32_t* pTwiddle;
+    const uint16_t* pBitRevTable;
+    uint16_t bitRevLength;
+} arm_cfft_instance_f32;
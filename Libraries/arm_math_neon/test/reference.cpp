@@ -0,0 +1,147 @@
+#include "reference.h"
+
+static q15_t saturateQ15(int32_t value)
+{
+    if (value > INT16_MAX) { return INT16_MAX; }
+    if (value < INT16_MIN) { return INT16_MIN; }
+    return (q15_t)value;
+}
+
+void ref_add_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = pSrcA[i] + pSrcB[i]; }
+}
+
+void ref_sub_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = pSrcA[i] - pSrcB[i]; }
+}
+
+void ref_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = pSrcA[i] * pSrcB[i]; }
+}
+
+void ref_scale_f32(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = pSrc[i] * scale; }
+}
+
+void ref_offset_f32(const float32_t* pSrc, float32_t offset, float32_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = pSrc[i] + offset; }
+}
+
+void ref_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result)
+{
+    float32_t sum = 0.0f;
+    for (uint32_t i = 0; i < blockSize; i++) { sum += pSrcA[i] * pSrcB[i]; }
+    *result = sum;
+}
+
+void ref_add_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = saturateQ15((int32_t)pSrcA[i] + pSrcB[i]); }
+}
+
+void ref_sub_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = saturateQ15((int32_t)pSrcA[i] - pSrcB[i]); }
+}
+
+void ref_mult_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = saturateQ15(((int32_t)pSrcA[i] * pSrcB[i]) >> 15); }
+}
+
+void ref_scale_q15(const q15_t* pSrc, q15_t scaleFract, int8_t shift, q15_t* pDst, uint32_t blockSize)
+{
+    const int32_t kShift = 15 - shift;
+    for (uint32_t i = 0; i < blockSize; i++) { pDst[i] = saturateQ15(((int32_t)pSrc[i] * scaleFract) >> kShift); }
+}
+
+void ref_fir_f32(const arm_fir_instance_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize)
+{
+    float32_t* pState = S->pState;
+    const float32_t* pCoeffs = S->pCoeffs;
+    const uint32_t numTaps = S->numTaps;
+
+    for (uint32_t i = 0; i < blockSize; i++) { pState[numTaps - 1 + i] = pSrc[i]; }
+    for (uint32_t n = 0; n < blockSize; n++) {
+        float32_t acc = 0.0f;
+        for (uint32_t k = 0; k < numTaps; k++) { acc += pCoeffs[k] * pState[n + k]; }
+        pDst[n] = acc;
+    }
+    for (uint32_t i = 0; i < numTaps - 1; i++) { pState[i] = pState[blockSize + i]; }
+}
+
+void ref_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize)
+{
+    const float32_t* pIn = pSrc;
+    float32_t* pState = S->pState;
+    const float32_t* pCoeffs = S->pCoeffs;
+
+    for (uint32_t stage = 0; stage < S->numStages; stage++) {
+        const float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];
+        const float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+        float32_t xn1 = pState[0], xn2 = pState[1], yn1 = pState[2], yn2 = pState[3];
+
+        for (uint32_t n = 0; n < blockSize; n++) {
+            float32_t xn = pIn[n];
+            float32_t yn = b0 * xn + b1 * xn1 + b2 * xn2 + a1 * yn1 + a2 * yn2;
+            xn2 = xn1; xn1 = xn;
+            yn2 = yn1; yn1 = yn;
+            pDst[n] = yn;
+        }
+
+        pState[0] = xn1; pState[1] = xn2; pState[2] = yn1; pState[3] = yn2;
+        pState  += 4;
+        pCoeffs += 5;
+        pIn = pDst;
+    }
+}
+
+void ref_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+    const uint32_t fftLen = S->fftLen;
+    const float32_t sinSign = ifftFlag ? -1.0f : 1.0f;
+
+    for (uint32_t m = fftLen; m >= 2; m >>= 1) {
+        const uint32_t half = m >> 1;
+        const uint32_t twiddleStride = fftLen / m;
+        for (uint32_t group = 0; group < fftLen; group += m) {
+            for (uint32_t j = 0; j < half; j++) {
+                const float32_t wr = S->pTwiddle[2 * j * twiddleStride];
+                const float32_t wi = sinSign * S->pTwiddle[2 * j * twiddleStride + 1];
+                float32_t* pA = p1 + 2 * (group + j);
+                float32_t* pB = pA + 2 * half;
+                float32_t dr = pA[0] - pB[0];
+                float32_t di = pA[1] - pB[1];
+                pA[0] += pB[0];
+                pA[1] += pB[1];
+                pB[0] = dr * wr + di * wi;
+                pB[1] = di * wr - dr * wi;
+            }
+        }
+    }
+
+    if (bitReverseFlag) {
+        for (uint32_t i = 1, j = 0; i < fftLen; i++) {
+            uint32_t bit = fftLen >> 1;
+            for (; j & bit; bit >>= 1) { j ^= bit; }
+            j ^= bit;
+            if (i < j) {
+                float32_t re = p1[2 * i], im = p1[2 * i + 1];
+                p1[2 * i] = p1[2 * j];
+                p1[2 * i + 1] = p1[2 * j + 1];
+                p1[2 * j] = re;
+                p1[2 * j + 1] = im;
+            }
+        }
+    }
+
+    if (ifftFlag) {
+        const float32_t scale = 1.0f / fftLen;
+        for (uint32_t i = 0; i < 2 * fftLen; i++) { p1[i] *= scale; }
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Scalar reference kernels following the CMSIS-DSP generic C code, used as the baseline for both the
+// test and the benchmark. reference.cpp is built without auto-vectorization so the baseline stays scalar.
+
+#include <stdint.h>
+#include "arm_math.h"
+
+void ref_add_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void ref_sub_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void ref_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void ref_scale_f32(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize);
+void ref_offset_f32(const float32_t* pSrc, float32_t offset, float32_t* pDst, uint32_t blockSize);
+void ref_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result);
+
+void ref_add_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize);
+void ref_sub_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize);
+void ref_mult_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize);
+void ref_scale_q15(const q15_t* pSrc, q15_t scaleFract, int8_t shift, q15_t* pDst, uint32_t blockSize);
+
+void ref_fir_f32(const arm_fir_instance_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize);
+void ref_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize);
+
+// Radix-2 with the same twiddle table, output order and 1/N inverse scaling as arm_cfft_f32()
+void ref_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
@@ -0,0 +1,264 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#include "arm_math_neon_RPI4B.h"
+
+static const unsigned char temp0[] = {35,112,114,97,103,109,97,32,111,110,99,101,10,10,47,47,32,78,69,79,78,32,107,101,114,110,101,108,115,32,102,111,114,32,116,104,101,32,67,111,114,116,101,120,45,65,55,50,32,119,105,
+116,104,32,116,104,101,32,115,97,109,101,32,115,105,103,110,97,116,117,114,101,115,32,97,115,32,116,104,101,32,67,77,83,73,83,45,68,83,80,32,102,117,110,99,116,105,111,110,115,32,
+116,104,101,121,32,114,101,112,108,97,99,101,46,10,47,47,32,67,77,83,73,83,45,68,83,80,32,116,97,114,103,101,116,115,32,67,111,114,116,101,120,45,77,44,32,111,110,32,97,97,114,99,
+104,54,52,32,105,116,32,102,97,108,108,115,32,98,97,99,107,32,116,111,32,103,101,110,101,114,105,99,32,67,46,32,67,97,108,108,32,116,104,101,32,42,95,110,101,111,110,32,102,117,
+110,99,116,105,111,110,115,32,100,105,114,101,99,116,108,121,44,10,47,47,32,111,114,32,100,101,102,105,110,101,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,79,86,69,82,82,73,68,69,
+32,98,101,102,111,114,101,32,105,110,99,108,117,100,105,110,103,32,116,104,105,115,32,104,101,97,100,101,114,32,116,111,32,114,101,100,105,114,101,99,116,32,116,104,101,32,97,114,
+109,95,42,32,99,97,108,108,115,32,116,104,97,116,32,102,111,108,108,111,119,46,10,47,47,10,47,47,32,73,110,116,101,110,100,101,100,32,97,99,99,117,114,97,99,121,32,99,111,109,112,
+97,114,101,100,32,116,111,32,67,77,83,73,83,45,68,83,80,58,10,47,47,32,32,45,32,97,100,100,44,32,115,117,98,44,32,109,117,108,116,44,32,115,99,97,108,101,44,32,111,102,102,115,101,
+116,32,40,102,51,50,41,32,97,110,100,32,97,108,108,32,113,49,53,32,102,117,110,99,116,105,111,110,115,32,97,114,101,32,98,105,116,45,101,120,97,99,116,10,47,47,32,32,45,32,100,111,
+116,95,112,114,111,100,44,32,102,105,114,44,32,98,105,113,117,97,100,95,99,97,115,99,97,100,101,95,100,102,49,32,97,110,100,32,99,102,102,116,32,115,117,109,32,105,110,32,97,32,
+100,105,102,102,101,114,101,110,116,32,111,114,100,101,114,32,97,110,100,32,117,115,101,32,102,117,115,101,100,32,109,117,108,116,105,112,108,121,45,97,100,100,44,10,47,47,32,32,
+32,32,115,111,32,114,101,115,117,108,116,115,32,109,97,116,99,104,32,116,111,32,119,105,116,104,105,110,32,110,111,114,109,97,108,32,102,108,111,97,116,32,114,111,117,110,100,105,
+110,103,32,40,97,114,111,117,110,100,32,49,101,45,54,32,114,101,108,97,116,105,118,101,32,116,111,32,116,104,101,32,115,105,103,110,97,108,32,108,101,118,101,108,41,10,47,47,32,32,
+45,32,99,102,102,116,32,119,105,116,104,32,98,105,116,82,101,118,101,114,115,101,70,108,97,103,32,61,32,48,32,108,101,97,118,101,115,32,116,104,101,32,111,117,116,112,117,116,32,
+105,110,32,115,116,97,110,100,97,114,100,32,98,105,116,45,114,101,118,101,114,115,101,100,32,111,114,100,101,114,10,47,47,32,116,101,115,116,47,32,99,104,101,99,107,115,32,116,104,
+101,115,101,32,97,103,97,105,110,115,116,32,115,99,97,108,97,114,32,114,101,102,101,114,101,110,99,101,115,46,32,83,111,32,102,97,114,32,116,104,97,116,32,104,97,115,32,111,110,
+108,121,32,114,117,110,32,111,110,32,116,104,101,32,115,99,97,108,97,114,32,102,97,108,108,98,97,99,107,32,97,110,100,32,111,110,10,47,47,32,120,56,54,45,54,52,32,119,105,116,104,
+32,116,104,101,32,78,69,79,78,32,105,110,116,114,105,110,115,105,99,115,32,101,109,117,108,97,116,101,100,44,32,110,111,116,32,121,101,116,32,111,110,32,97,110,32,97,97,114,99,104,
+54,52,32,116,97,114,103,101,116,32,111,114,32,117,110,100,101,114,32,113,101,109,117,45,117,115,101,114,44,32,97,110,100,32,116,104,101,10,47,47,32,115,112,101,101,100,117,112,115,
+32,104,97,118,101,32,110,111,116,32,98,101,101,110,32,109,101,97,115,117,114,101,100,46,32,82,117,110,32,34,109,97,107,101,32,116,101,115,116,32,98,101,110,99,104,34,32,105,110,32,
+116,101,115,116,47,32,116,104,101,114,101,32,98,101,102,111,114,101,32,114,101,108,121,105,110,103,32,111,110,32,101,105,116,104,101,114,46,10,10,35,105,110,99,108,117,100,101,32,
+60,115,116,100,105,110,116,46,104,62,10,35,105,110,99,108,117,100,101,32,34,97,114,109,95,109,97,116,104,46,104,34,10,10,35,105,102,32,100,101,102,105,110,101,100,40,95,95,97,97,
+114,99,104,54,52,95,95,41,32,38,38,32,100,101,102,105,110,101,100,40,95,95,65,82,77,95,78,69,79,78,41,10,35,105,110,99,108,117,100,101,32,60,97,114,109,95,110,101,111,110,46,104,
+62,10,35,100,101,102,105,110,101,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,32,49,10,35,101,108,115,101,10,35,100,101,102,105,110,101,32,65,82,77,95,77,65,
+84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,32,48,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,95,95,99,112,108,117,115,112,108,117,115,10,101,120,116,101,114,110,32,
+34,67,34,32,123,10,35,101,110,100,105,102,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,113,49,53,95,116,32,97,114,109,95,110,101,111,110,95,115,97,116,95,113,49,53,40,
+105,110,116,51,50,95,116,32,118,97,108,117,101,41,10,123,10,32,32,32,32,105,102,32,40,118,97,108,117,101,32,62,32,73,78,84,49,54,95,77,65,88,41,32,123,32,114,101,116,117,114,110,
+32,73,78,84,49,54,95,77,65,88,59,32,125,10,32,32,32,32,105,102,32,40,118,97,108,117,101,32,60,32,73,78,84,49,54,95,77,73,78,41,32,123,32,114,101,116,117,114,110,32,73,78,84,49,54,
+95,77,73,78,59,32,125,10,32,32,32,32,114,101,116,117,114,110,32,40,113,49,53,95,116,41,118,97,108,117,101,59,10,125,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,10,47,47,32,66,97,115,105,99,32,109,97,116,104,44,32,102,51,50,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,115,116,97,116,105,99,32,105,110,108,105,
+110,101,32,118,111,105,100,32,97,114,109,95,97,100,100,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,65,44,32,99,111,
+110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,66,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,
+99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,
+10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,32,32,118,115,116,49,
+113,95,102,51,50,40,112,68,115,116,32,43,32,105,44,32,118,97,100,100,113,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,112,83,114,99,65,32,43,32,105,41,44,32,118,108,100,49,
+113,95,102,51,50,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,108,111,99,107,83,
+105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,112,83,114,99,65,91,105,93,32,43,32,112,83,114,99,66,91,105,93,59,32,125,10,125,10,10,115,116,97,116,105,
+99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,115,117,98,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,
+114,99,65,44,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,66,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,
+95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,
+69,78,65,66,76,69,68,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,32,
+32,118,115,116,49,113,95,102,51,50,40,112,68,115,116,32,43,32,105,44,32,118,115,117,98,113,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,112,83,114,99,65,32,43,32,105,41,44,
+32,118,108,100,49,113,95,102,51,50,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,
+108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,112,83,114,99,65,91,105,93,32,45,32,112,83,114,99,66,91,105,93,59,32,125,10,125,10,10,
+115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,109,117,108,116,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,102,108,111,97,116,51,
+50,95,116,42,32,112,83,114,99,65,44,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,66,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,
+32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,
+84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,52,41,32,123,
+10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,102,51,50,40,112,68,115,116,32,43,32,105,44,32,118,109,117,108,113,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,112,83,114,
+99,65,32,43,32,105,41,44,32,118,108,100,49,113,95,102,51,50,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,
+40,59,32,105,32,60,32,98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,112,83,114,99,65,91,105,93,32,42,32,112,83,114,99,66,91,105,
+93,59,32,125,10,125,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,115,99,97,108,101,95,102,51,50,95,110,101,111,110,40,99,111,110,115,
+116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,44,32,102,108,111,97,116,51,50,95,116,32,115,99,97,108,101,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,
+32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,
+84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,52,41,32,123,
+10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,102,51,50,40,112,68,115,116,32,43,32,105,44,32,118,109,117,108,113,95,110,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,112,
+83,114,99,32,43,32,105,41,44,32,115,99,97,108,101,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,108,111,99,107,83,
+105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,112,83,114,99,91,105,93,32,42,32,115,99,97,108,101,59,32,125,10,125,10,10,115,116,97,116,105,99,32,105,
+110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,111,102,102,115,101,116,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,
+83,114,99,44,32,102,108,111,97,116,51,50,95,116,32,111,102,102,115,101,116,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,
+111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,
+68,10,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,118,79,102,102,115,101,116,32,61,32,118,100,117,112,113,95,110,95,102,51,50,40,111,102,102,115,101,116,41,59,10,32,32,
+32,32,102,111,114,32,40,59,32,105,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,102,
+51,50,40,112,68,115,116,32,43,32,105,44,32,118,97,100,100,113,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,112,83,114,99,32,43,32,105,41,44,32,118,79,102,102,115,101,116,41,
+41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,
+91,105,93,32,61,32,112,83,114,99,91,105,93,32,43,32,111,102,102,115,101,116,59,32,125,10,125,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,
+109,95,100,111,116,95,112,114,111,100,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,65,44,32,99,111,110,115,116,32,
+102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,66,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,101,44,32,102,108,111,97,116,51,50,95,116,42,32,114,101,
+115,117,108,116,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,32,32,32,32,102,108,111,97,116,51,50,95,116,32,115,117,109,32,61,32,48,46,48,102,59,
+10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,47,47,32,116,119,111,32,97,99,99,117,109,117,108,97,116,111,114,115,32,116,111,32,
+104,105,100,101,32,116,104,101,32,70,77,65,32,108,97,116,101,110,99,121,10,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,97,99,99,48,32,61,32,118,100,117,112,113,95,110,95,
+102,51,50,40,48,46,48,102,41,59,10,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,97,99,99,49,32,61,32,118,100,117,112,113,95,110,95,102,51,50,40,48,46,48,102,41,59,10,32,
+32,32,32,102,111,114,32,40,59,32,105,32,43,32,56,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,56,41,32,123,10,32,32,32,32,32,32,32,32,97,99,99,48,32,61,32,
+118,102,109,97,113,95,102,51,50,40,97,99,99,48,44,32,118,108,100,49,113,95,102,51,50,40,112,83,114,99,65,32,43,32,105,41,44,32,32,32,32,32,118,108,100,49,113,95,102,51,50,40,112,
+83,114,99,66,32,43,32,105,41,41,59,10,32,32,32,32,32,32,32,32,97,99,99,49,32,61,32,118,102,109,97,113,95,102,51,50,40,97,99,99,49,44,32,118,108,100,49,113,95,102,51,50,40,112,83,
+114,99,65,32,43,32,105,32,43,32,52,41,44,32,118,108,100,49,113,95,102,51,50,40,112,83,114,99,66,32,43,32,105,32,43,32,52,41,41,59,10,32,32,32,32,125,10,32,32,32,32,115,117,109,32,
+61,32,118,97,100,100,118,113,95,102,51,50,40,118,97,100,100,113,95,102,51,50,40,97,99,99,48,44,32,97,99,99,49,41,41,59,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,
+59,32,105,32,60,32,98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,115,117,109,32,43,61,32,112,83,114,99,65,91,105,93,32,42,32,112,83,114,99,66,91,105,93,59,32,125,
+10,32,32,32,32,42,114,101,115,117,108,116,32,61,32,115,117,109,59,10,125,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,66,97,115,105,99,32,109,
+97,116,104,44,32,113,49,53,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,
+95,97,100,100,95,113,49,53,95,110,101,111,110,40,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,65,44,32,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,66,
+44,32,113,49,53,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,
+61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,56,32,60,61,32,98,108,111,99,107,83,
+105,122,101,59,32,105,32,43,61,32,56,41,32,123,10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,115,49,54,40,112,68,115,116,32,43,32,105,44,32,118,113,97,100,100,113,95,115,49,54,
+40,118,108,100,49,113,95,115,49,54,40,112,83,114,99,65,32,43,32,105,41,44,32,118,108,100,49,113,95,115,49,54,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,
+101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,97,114,109,
+95,110,101,111,110,95,115,97,116,95,113,49,53,40,40,105,110,116,51,50,95,116,41,112,83,114,99,65,91,105,93,32,43,32,112,83,114,99,66,91,105,93,41,59,32,125,10,125,10,10,115,116,97,
+116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,115,117,98,95,113,49,53,95,110,101,111,110,40,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,
+65,44,32,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,66,44,32,113,49,53,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,
+122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,
+102,111,114,32,40,59,32,105,32,43,32,56,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,56,41,32,123,10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,115,49,54,
+40,112,68,115,116,32,43,32,105,44,32,118,113,115,117,98,113,95,115,49,54,40,118,108,100,49,113,95,115,49,54,40,112,83,114,99,65,32,43,32,105,41,44,32,118,108,100,49,113,95,115,49,
+54,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,98,108,111,99,107,83,105,122,101,
+59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,97,114,109,95,110,101,111,110,95,115,97,116,95,113,49,53,40,40,105,110,116,51,50,95,116,41,112,83,114,99,65,91,105,
+93,32,45,32,112,83,114,99,66,91,105,93,41,59,32,125,10,125,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,109,117,108,116,95,113,49,53,
+95,110,101,111,110,40,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,65,44,32,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,66,44,32,113,49,53,95,116,42,
+32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,35,105,102,
+32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,47,47,32,115,97,116,117,114,97,116,105,110,103,32,100,111,117,98,108,105,110,103,32,109,117,108,
+116,105,112,108,121,32,104,105,103,104,32,105,115,32,40,97,42,98,41,32,62,62,32,49,53,32,119,105,116,104,32,115,97,116,117,114,97,116,105,111,110,44,32,115,97,109,101,32,97,115,32,
+67,77,83,73,83,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,56,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,32,56,41,32,123,10,32,32,32,32,32,32,32,32,
+118,115,116,49,113,95,115,49,54,40,112,68,115,116,32,43,32,105,44,32,118,113,100,109,117,108,104,113,95,115,49,54,40,118,108,100,49,113,95,115,49,54,40,112,83,114,99,65,32,43,32,
+105,41,44,32,118,108,100,49,113,95,115,49,54,40,112,83,114,99,66,32,43,32,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,
+32,60,32,98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,97,114,109,95,110,101,111,110,95,115,97,116,95,113,49,53,40,40,40,105,110,
+116,51,50,95,116,41,112,83,114,99,65,91,105,93,32,42,32,112,83,114,99,66,91,105,93,41,32,62,62,32,49,53,41,59,32,125,10,125,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,
+32,118,111,105,100,32,97,114,109,95,115,99,97,108,101,95,113,49,53,95,110,101,111,110,40,99,111,110,115,116,32,113,49,53,95,116,42,32,112,83,114,99,44,32,113,49,53,95,116,32,115,
+99,97,108,101,70,114,97,99,116,44,32,105,110,116,56,95,116,32,115,104,105,102,116,44,32,113,49,53,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,
+107,83,105,122,101,41,10,123,10,32,32,32,32,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,10,32,32,32,32,105,110,116,51,50,95,116,32,107,83,104,105,102,116,32,61,32,49,53,32,
+45,32,115,104,105,102,116,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,105,110,116,49,54,120,52,95,116,32,118,83,99,97,108,101,
+32,61,32,118,100,117,112,95,110,95,115,49,54,40,115,99,97,108,101,70,114,97,99,116,41,59,10,32,32,32,32,105,110,116,51,50,120,52,95,116,32,118,83,104,105,102,116,32,61,32,118,100,
+117,112,113,95,110,95,115,51,50,40,45,107,83,104,105,102,116,41,59,32,47,47,32,110,101,103,97,116,105,118,101,32,115,104,105,102,116,32,105,115,32,97,110,32,97,114,105,116,104,109,
+101,116,105,99,32,114,105,103,104,116,32,115,104,105,102,116,10,32,32,32,32,102,111,114,32,40,59,32,105,32,43,32,56,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,105,32,43,61,
+32,56,41,32,123,10,32,32,32,32,32,32,32,32,105,110,116,49,54,120,56,95,116,32,105,110,32,61,32,118,108,100,49,113,95,115,49,54,40,112,83,114,99,32,43,32,105,41,59,10,32,32,32,32,
+32,32,32,32,105,110,116,51,50,120,52,95,116,32,108,111,32,61,32,118,115,104,108,113,95,115,51,50,40,118,109,117,108,108,95,115,49,54,40,118,103,101,116,95,108,111,119,95,115,49,54,
+40,105,110,41,44,32,32,118,83,99,97,108,101,41,44,32,118,83,104,105,102,116,41,59,10,32,32,32,32,32,32,32,32,105,110,116,51,50,120,52,95,116,32,104,105,32,61,32,118,115,104,108,
+113,95,115,51,50,40,118,109,117,108,108,95,115,49,54,40,118,103,101,116,95,104,105,103,104,95,115,49,54,40,105,110,41,44,32,118,83,99,97,108,101,41,44,32,118,83,104,105,102,116,41,
+59,10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,115,49,54,40,112,68,115,116,32,43,32,105,44,32,118,99,111,109,98,105,110,101,95,115,49,54,40,118,113,109,111,118,110,95,115,51,
+50,40,108,111,41,44,32,118,113,109,111,118,110,95,115,51,50,40,104,105,41,41,41,59,10,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,105,32,60,32,
+98,108,111,99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,68,115,116,91,105,93,32,61,32,97,114,109,95,110,101,111,110,95,115,97,116,95,113,49,53,40,40,40,105,110,116,51,50,
+95,116,41,112,83,114,99,91,105,93,32,42,32,115,99,97,108,101,70,114,97,99,116,41,32,62,62,32,107,83,104,105,102,116,41,59,32,125,10,125,10,10,47,47,47,47,47,47,47,47,47,47,47,47,
+47,47,47,47,47,47,47,47,47,10,47,47,32,70,105,108,116,101,114,115,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,115,116,97,116,105,99,32,105,110,108,105,110,
+101,32,118,111,105,100,32,97,114,109,95,102,105,114,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,97,114,109,95,102,105,114,95,105,110,115,116,97,110,99,101,95,102,51,
+50,42,32,83,44,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,
+95,116,32,98,108,111,99,107,83,105,122,101,41,10,123,10,32,32,32,32,47,47,32,83,97,109,101,32,115,116,97,116,101,32,108,97,121,111,117,116,32,97,115,32,67,77,83,73,83,44,32,110,
+117,109,84,97,112,115,45,49,32,112,114,101,118,105,111,117,115,32,115,97,109,112,108,101,115,32,102,111,108,108,111,119,101,100,32,98,121,32,116,104,101,32,110,101,119,32,98,108,
+111,99,107,10,32,32,32,32,102,108,111,97,116,51,50,95,116,42,32,112,83,116,97,116,101,32,61,32,83,45,62,112,83,116,97,116,101,59,10,32,32,32,32,99,111,110,115,116,32,102,108,111,
+97,116,51,50,95,116,42,32,112,67,111,101,102,102,115,32,61,32,83,45,62,112,67,111,101,102,102,115,59,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,51,50,95,116,32,110,117,
+109,84,97,112,115,32,61,32,83,45,62,110,117,109,84,97,112,115,59,10,10,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,32,105,32,60,32,98,108,111,
+99,107,83,105,122,101,59,32,105,43,43,41,32,123,32,112,83,116,97,116,101,91,110,117,109,84,97,112,115,32,45,32,49,32,43,32,105,93,32,61,32,112,83,114,99,91,105,93,59,32,125,10,10,
+32,32,32,32,117,105,110,116,51,50,95,116,32,110,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,47,47,32,102,111,117,
+114,32,111,117,116,112,117,116,115,32,97,116,32,97,32,116,105,109,101,44,32,101,97,99,104,32,116,97,112,32,105,115,32,111,110,101,32,70,77,65,32,97,99,114,111,115,115,32,116,104,
+101,32,102,111,117,114,10,32,32,32,32,102,111,114,32,40,59,32,110,32,43,32,52,32,60,61,32,98,108,111,99,107,83,105,122,101,59,32,110,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,
+32,32,102,108,111,97,116,51,50,120,52,95,116,32,97,99,99,32,61,32,118,100,117,112,113,95,110,95,102,51,50,40,48,46,48,102,41,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,
+105,110,116,51,50,95,116,32,107,32,61,32,48,59,32,107,32,60,32,110,117,109,84,97,112,115,59,32,107,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,97,99,99,32,61,32,118,102,
+109,97,113,95,110,95,102,51,50,40,97,99,99,44,32,118,108,100,49,113,95,102,51,50,40,112,83,116,97,116,101,32,43,32,110,32,43,32,107,41,44,32,112,67,111,101,102,102,115,91,107,93,
+41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,118,115,116,49,113,95,102,51,50,40,112,68,115,116,32,43,32,110,44,32,97,99,99,41,59,10,32,32,32,32,125,10,35,101,
+110,100,105,102,10,32,32,32,32,102,111,114,32,40,59,32,110,32,60,32,98,108,111,99,107,83,105,122,101,59,32,110,43,43,41,32,123,10,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,
+95,116,32,97,99,99,32,61,32,48,46,48,102,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,107,32,61,32,48,59,32,107,32,60,32,110,117,109,84,97,112,
+115,59,32,107,43,43,41,32,123,32,97,99,99,32,43,61,32,112,67,111,101,102,102,115,91,107,93,32,42,32,112,83,116,97,116,101,91,110,32,43,32,107,93,59,32,125,10,32,32,32,32,32,32,32,
+32,112,68,115,116,91,110,93,32,61,32,97,99,99,59,10,32,32,32,32,125,10,10,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,32,105,32,60,32,110,117,
+109,84,97,112,115,32,45,32,49,59,32,105,43,43,41,32,123,32,112,83,116,97,116,101,91,105,93,32,61,32,112,83,116,97,116,101,91,98,108,111,99,107,83,105,122,101,32,43,32,105,93,59,32,
+125,10,125,10,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,114,109,95,98,105,113,117,97,100,95,99,97,115,99,97,100,101,95,100,102,49,95,102,51,50,
+95,110,101,111,110,40,99,111,110,115,116,32,97,114,109,95,98,105,113,117,97,100,95,99,97,115,100,95,100,102,49,95,105,110,115,116,95,102,51,50,42,32,83,44,32,99,111,110,115,116,32,
+102,108,111,97,116,51,50,95,116,42,32,112,83,114,99,44,32,102,108,111,97,116,51,50,95,116,42,32,112,68,115,116,44,32,117,105,110,116,51,50,95,116,32,98,108,111,99,107,83,105,122,
+101,41,10,123,10,32,32,32,32,47,47,32,84,104,101,32,102,101,101,100,45,102,111,114,119,97,114,100,32,104,97,108,102,32,111,102,32,101,97,99,104,32,115,116,97,103,101,32,104,97,115,
+32,110,111,32,114,101,99,117,114,115,105,111,110,32,115,111,32,105,116,32,105,115,32,118,101,99,116,111,114,105,122,101,100,32,111,118,101,114,32,116,104,101,32,98,108,111,99,107,
+44,10,32,32,32,32,47,47,32,119,104,105,99,104,32,108,101,97,118,101,115,32,111,110,108,121,32,116,119,111,32,109,117,108,116,105,112,108,121,45,97,100,100,115,32,112,101,114,32,
+115,97,109,112,108,101,32,105,110,32,116,104,101,32,115,101,114,105,97,108,32,102,101,101,100,98,97,99,107,32,112,97,116,104,46,10,32,32,32,32,101,110,117,109,32,123,32,67,72,85,
+78,75,95,83,73,90,69,32,61,32,54,52,32,125,59,10,32,32,32,32,102,108,111,97,116,51,50,95,116,32,120,66,117,102,91,67,72,85,78,75,95,83,73,90,69,32,43,32,50,93,59,32,47,47,32,120,
+91,110,45,50,93,44,32,120,91,110,45,49,93,44,32,120,91,110,93,32,46,46,46,10,32,32,32,32,102,108,111,97,116,51,50,95,116,32,102,102,66,117,102,91,67,72,85,78,75,95,83,73,90,69,93,
+59,10,10,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,73,110,32,61,32,112,83,114,99,59,10,32,32,32,32,102,108,111,97,116,51,50,95,116,42,32,112,83,
+116,97,116,101,32,61,32,83,45,62,112,83,116,97,116,101,59,10,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,42,32,112,67,111,101,102,102,115,32,61,32,83,45,62,
+112,67,111,101,102,102,115,59,10,10,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,115,116,97,103,101,32,61,32,48,59,32,115,116,97,103,101,32,60,32,83,45,62,110,117,
+109,83,116,97,103,101,115,59,32,115,116,97,103,101,43,43,41,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,32,98,48,32,61,32,112,67,111,
+101,102,102,115,91,48,93,44,32,98,49,32,61,32,112,67,111,101,102,102,115,91,49,93,44,32,98,50,32,61,32,112,67,111,101,102,102,115,91,50,93,59,10,32,32,32,32,32,32,32,32,99,111,110,
+115,116,32,102,108,111,97,116,51,50,95,116,32,97,49,32,61,32,112,67,111,101,102,102,115,91,51,93,44,32,97,50,32,61,32,112,67,111,101,102,102,115,91,52,93,59,10,32,32,32,32,32,32,
+32,32,102,108,111,97,116,51,50,95,116,32,120,110,49,32,61,32,112,83,116,97,116,101,91,48,93,44,32,120,110,50,32,61,32,112,83,116,97,116,101,91,49,93,44,32,121,110,49,32,61,32,112,
+83,116,97,116,101,91,50,93,44,32,121,110,50,32,61,32,112,83,116,97,116,101,91,51,93,59,10,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,111,102,102,
+115,101,116,32,61,32,48,59,32,111,102,102,115,101,116,32,60,32,98,108,111,99,107,83,105,122,101,59,32,111,102,102,115,101,116,32,43,61,32,67,72,85,78,75,95,83,73,90,69,41,32,123,
+10,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,51,50,95,116,32,99,104,117,110,107,83,105,122,101,32,61,32,40,98,108,111,99,107,83,105,122,101,32,45,32,111,102,102,115,101,
+116,32,60,32,67,72,85,78,75,95,83,73,90,69,41,32,63,32,40,98,108,111,99,107,83,105,122,101,32,45,32,111,102,102,115,101,116,41,32,58,32,67,72,85,78,75,95,83,73,90,69,59,10,32,32,
+32,32,32,32,32,32,32,32,32,32,120,66,117,102,91,48,93,32,61,32,120,110,50,59,10,32,32,32,32,32,32,32,32,32,32,32,32,120,66,117,102,91,49,93,32,61,32,120,110,49,59,10,32,32,32,32,
+32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,105,32,61,32,48,59,32,105,32,60,32,99,104,117,110,107,83,105,122,101,59,32,105,43,43,41,32,123,32,120,66,
+117,102,91,105,32,43,32,50,93,32,61,32,112,73,110,91,111,102,102,115,101,116,32,43,32,105,93,59,32,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,51,50,95,116,32,
+110,32,61,32,48,59,10,35,105,102,32,65,82,77,95,77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,59,32,110,32,43,32,52,
+32,60,61,32,99,104,117,110,107,83,105,122,101,59,32,110,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,102,
+102,32,61,32,118,109,117,108,113,95,110,95,102,51,50,40,118,108,100,49,113,95,102,51,50,40,120,66,117,102,32,43,32,110,32,43,32,50,41,44,32,98,48,41,59,10,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,102,102,32,61,32,118,102,109,97,113,95,110,95,102,51,50,40,102,102,44,32,118,108,100,49,113,95,102,51,50,40,120,66,117,102,32,43,32,110,32,43,32,49,41,44,
+32,98,49,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,102,32,61,32,118,102,109,97,113,95,110,95,102,51,50,40,102,102,44,32,118,108,100,49,113,95,102,51,50,40,120,
+66,117,102,32,43,32,110,41,44,32,32,32,32,32,98,50,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,115,116,49,113,95,102,51,50,40,102,102,66,117,102,32,43,32,110,44,
+32,102,102,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,35,101,110,100,105,102,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,59,32,110,32,60,32,99,104,117,110,
+107,83,105,122,101,59,32,110,43,43,41,32,123,32,102,102,66,117,102,91,110,93,32,61,32,98,48,32,42,32,120,66,117,102,91,110,32,43,32,50,93,32,43,32,98,49,32,42,32,120,66,117,102,91,
+110,32,43,32,49,93,32,43,32,98,50,32,42,32,120,66,117,102,91,110,93,59,32,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,110,32,61,32,48,59,32,110,32,60,32,99,104,
+117,110,107,83,105,122,101,59,32,110,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,95,116,32,121,110,32,61,32,102,102,66,117,102,91,
+110,93,32,43,32,97,49,32,42,32,121,110,49,32,43,32,97,50,32,42,32,121,110,50,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,121,110,50,32,61,32,121,110,49,59,10,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,121,110,49,32,61,32,121,110,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,68,115,116,91,111,102,102,115,101,116,32,43,32,110,93,32,
+61,32,121,110,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,120,110,49,32,61,32,120,66,117,102,91,99,104,117,110,107,83,105,122,101,32,43,32,
+49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,120,110,50,32,61,32,120,66,117,102,91,99,104,117,110,107,83,105,122,101,93,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,
+32,32,32,112,83,116,97,116,101,91,48,93,32,61,32,120,110,49,59,32,112,83,116,97,116,101,91,49,93,32,61,32,120,110,50,59,32,112,83,116,97,116,101,91,50,93,32,61,32,121,110,49,59,32,
+112,83,116,97,116,101,91,51,93,32,61,32,121,110,50,59,10,32,32,32,32,32,32,32,32,112,83,116,97,116,101,32,32,43,61,32,52,59,10,32,32,32,32,32,32,32,32,112,67,111,101,102,102,115,
+32,43,61,32,53,59,10,32,32,32,32,32,32,32,32,112,73,110,32,61,32,112,68,115,116,59,32,47,47,32,108,97,116,101,114,32,115,116,97,103,101,115,32,119,111,114,107,32,105,110,32,112,
+108,97,99,101,32,111,110,32,116,104,101,32,111,117,116,112,117,116,10,32,32,32,32,125,10,125,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,84,
+114,97,110,115,102,111,114,109,115,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,115,116,97,116,105,99,32,105,110,108,105,110,101,32,118,111,105,100,32,97,
+114,109,95,99,102,102,116,95,102,51,50,95,110,101,111,110,40,99,111,110,115,116,32,97,114,109,95,99,102,102,116,95,105,110,115,116,97,110,99,101,95,102,51,50,42,32,83,44,32,102,
+108,111,97,116,51,50,95,116,42,32,112,49,44,32,117,105,110,116,56,95,116,32,105,102,102,116,70,108,97,103,44,32,117,105,110,116,56,95,116,32,98,105,116,82,101,118,101,114,115,101,
+70,108,97,103,41,10,123,10,32,32,32,32,47,47,32,82,97,100,105,120,45,50,32,100,101,99,105,109,97,116,105,111,110,32,105,110,32,102,114,101,113,117,101,110,99,121,32,117,115,105,
+110,103,32,116,104,101,32,67,77,83,73,83,32,116,119,105,100,100,108,101,32,116,97,98,108,101,32,40,99,111,115,44,32,115,105,110,32,112,97,105,114,115,32,102,111,114,32,107,32,61,
+32,48,32,46,46,32,51,78,47,52,41,46,10,32,32,32,32,47,47,32,70,111,114,119,97,114,100,32,117,115,101,115,32,87,32,61,32,99,111,115,32,45,32,106,42,115,105,110,44,32,105,110,118,
+101,114,115,101,32,117,115,101,115,32,116,104,101,32,99,111,110,106,117,103,97,116,101,32,97,110,100,32,115,99,97,108,101,115,32,98,121,32,49,47,78,32,108,105,107,101,32,67,77,83,
+73,83,46,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,51,50,95,116,32,102,102,116,76,101,110,32,61,32,83,45,62,102,102,116,76,101,110,59,10,32,32,32,32,99,111,110,115,116,
+32,102,108,111,97,116,51,50,95,116,42,32,112,84,119,105,100,100,108,101,32,61,32,83,45,62,112,84,119,105,100,100,108,101,59,10,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,
+51,50,95,116,32,115,105,110,83,105,103,110,32,61,32,105,102,102,116,70,108,97,103,32,63,32,45,49,46,48,102,32,58,32,49,46,48,102,59,10,10,32,32,32,32,102,111,114,32,40,117,105,110,
+116,51,50,95,116,32,109,32,61,32,102,102,116,76,101,110,59,32,109,32,62,61,32,50,59,32,109,32,62,62,61,32,49,41,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,117,105,110,
+116,51,50,95,116,32,104,97,108,102,32,61,32,109,32,62,62,32,49,59,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,117,105,110,116,51,50,95,116,32,116,119,105,100,100,108,101,83,
+116,114,105,100,101,32,61,32,102,102,116,76,101,110,32,47,32,109,59,10,10,32,32,32,32,32,32,32,32,117,105,110,116,51,50,95,116,32,106,32,61,32,48,59,10,35,105,102,32,65,82,77,95,
+77,65,84,72,95,78,69,79,78,95,69,78,65,66,76,69,68,10,32,32,32,32,32,32,32,32,102,111,114,32,40,59,32,106,32,43,32,52,32,60,61,32,104,97,108,102,59,32,106,32,43,61,32,52,41,32,123,
+10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,95,116,32,119,114,91,52,93,44,32,119,105,91,52,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,117,
+105,110,116,51,50,95,116,32,107,32,61,32,48,59,32,107,32,60,32,52,59,32,107,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,119,114,91,107,93,32,61,32,112,84,
+119,105,100,100,108,101,91,50,32,42,32,40,106,32,43,32,107,41,32,42,32,116,119,105,100,100,108,101,83,116,114,105,100,101,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+119,105,91,107,93,32,61,32,115,105,110,83,105,103,110,32,42,32,112,84,119,105,100,100,108,101,91,50,32,42,32,40,106,32,43,32,107,41,32,42,32,116,119,105,100,100,108,101,83,116,114,
+105,100,101,32,43,32,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,120,52,95,116,32,118,
+119,114,32,61,32,118,108,100,49,113,95,102,51,50,40,119,114,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,120,52,95,116,32,118,119,
+105,32,61,32,118,108,100,49,113,95,102,51,50,40,119,105,41,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,103,114,111,117,112,32,61,
+32,48,59,32,103,114,111,117,112,32,60,32,102,102,116,76,101,110,59,32,103,114,111,117,112,32,43,61,32,109,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,
+97,116,51,50,95,116,42,32,112,65,32,61,32,112,49,32,43,32,50,32,42,32,40,103,114,111,117,112,32,43,32,106,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,
+116,51,50,95,116,42,32,112,66,32,61,32,112,65,32,43,32,50,32,42,32,104,97,108,102,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,120,50,95,
+116,32,97,32,61,32,118,108,100,50,113,95,102,51,50,40,112,65,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,120,50,95,116,32,98,32,61,32,
+118,108,100,50,113,95,102,51,50,40,112,66,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,120,50,95,116,32,115,117,109,44,32,112,114,111,
+100,117,99,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,109,46,118,97,108,91,48,93,32,61,32,118,97,100,100,113,95,102,51,50,40,97,46,118,97,108,91,48,93,44,32,
+98,46,118,97,108,91,48,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,109,46,118,97,108,91,49,93,32,61,32,118,97,100,100,113,95,102,51,50,40,97,46,118,97,108,
+91,49,93,44,32,98,46,118,97,108,91,49,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,100,114,32,61,32,118,115,117,98,113,95,
+102,51,50,40,97,46,118,97,108,91,48,93,44,32,98,46,118,97,108,91,48,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,120,52,95,116,32,100,105,
+32,61,32,118,115,117,98,113,95,102,51,50,40,97,46,118,97,108,91,49,93,44,32,98,46,118,97,108,91,49,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,40,100,114,
+32,43,32,106,42,100,105,41,32,42,32,40,119,114,32,45,32,106,42,119,105,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,114,111,100,117,99,116,46,118,97,108,91,48,93,32,
+61,32,118,102,109,97,113,95,102,51,50,40,118,109,117,108,113,95,102,51,50,40,100,114,44,32,118,119,114,41,44,32,100,105,44,32,118,119,105,41,59,10,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,112,114,111,100,117,99,116,46,118,97,108,91,49,93,32,61,32,118,102,109,115,113,95,102,51,50,40,118,109,117,108,113,95,102,51,50,40,100,105,44,32,118,119,114,41,44,
+32,100,114,44,32,118,119,105,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,115,116,50,113,95,102,51,50,40,112,65,44,32,115,117,109,41,59,10,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,118,115,116,50,113,95,102,51,50,40,112,66,44,32,112,114,111,100,117,99,116,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,
+10,35,101,110,100,105,102,10,32,32,32,32,32,32,32,32,102,111,114,32,40,59,32,106,32,60,32,104,97,108,102,59,32,106,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,
+110,115,116,32,102,108,111,97,116,51,50,95,116,32,119,114,32,61,32,112,84,119,105,100,100,108,101,91,50,32,42,32,106,32,42,32,116,119,105,100,100,108,101,83,116,114,105,100,101,93,
+59,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,51,50,95,116,32,119,105,32,61,32,115,105,110,83,105,103,110,32,42,32,112,84,119,105,100,100,108,
+101,91,50,32,42,32,106,32,42,32,116,119,105,100,100,108,101,83,116,114,105,100,101,32,43,32,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,
+95,116,32,103,114,111,117,112,32,61,32,48,59,32,103,114,111,117,112,32,60,32,102,102,116,76,101,110,59,32,103,114,111,117,112,32,43,61,32,109,41,32,123,10,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,95,116,42,32,112,65,32,61,32,112,49,32,43,32,50,32,42,32,40,103,114,111,117,112,32,43,32,106,41,59,10,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,102,108,111,97,116,51,50,95,116,42,32,112,66,32,61,32,112,65,32,43,32,50,32,42,32,104,97,108,102,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,
+111,97,116,51,50,95,116,32,100,114,32,61,32,112,65,91,48,93,32,45,32,112,66,91,48,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,95,116,32,100,
+105,32,61,32,112,65,91,49,93,32,45,32,112,66,91,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,65,91,48,93,32,43,61,32,112,66,91,48,93,59,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,112,65,91,49,93,32,43,61,32,112,66,91,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,66,91,48,93,32,61,32,100,114,32,42,32,119,114,32,
+43,32,100,105,32,42,32,119,105,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,66,91,49,93,32,61,32,100,105,32,42,32,119,114,32,45,32,100,114,32,42,32,119,105,59,10,32,
+32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,32,32,105,102,32,40,98,105,116,82,101,118,101,114,115,101,70,108,97,103,41,32,
+123,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,51,50,95,116,32,105,32,61,32,49,44,32,106,32,61,32,48,59,32,105,32,60,32,102,102,116,76,101,110,59,32,105,43,43,41,
+32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,51,50,95,116,32,98,105,116,32,61,32,102,102,116,76,101,110,32,62,62,32,49,59,10,32,32,32,32,32,32,32,32,32,32,32,32,
+102,111,114,32,40,59,32,106,32,38,32,98,105,116,59,32,98,105,116,32,62,62,61,32,49,41,32,123,32,106,32,94,61,32,98,105,116,59,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,106,32,
+94,61,32,98,105,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,105,32,60,32,106,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,51,50,
+95,116,32,114,101,32,61,32,112,49,91,50,32,42,32,105,93,44,32,105,109,32,61,32,112,49,91,50,32,42,32,105,32,43,32,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,
+49,91,50,32,42,32,105,93,32,61,32,112,49,91,50,32,42,32,106,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,49,91,50,32,42,32,105,32,43,32,49,93,32,61,32,112,49,91,50,
+32,42,32,106,32,43,32,49,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,49,91,50,32,42,32,106,93,32,61,32,114,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,112,49,91,50,32,42,32,106,32,43,32,49,93,32,61,32,105,109,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,32,32,105,
+102,32,40,105,102,102,116,70,108,97,103,41,32,123,32,97,114,109,95,115,99,97,108,101,95,102,51,50,95,110,101,111,110,40,112,49,44,32,49,46,48,102,32,47,32,102,102,116,76,101,110,
+44,32,112,49,44,32,50,32,42,32,102,102,116,76,101,110,41,59,32,125,10,125,10,10,35,105,102,100,101,102,32,95,95,99,112,108,117,115,112,108,117,115,10,125,10,35,101,110,100,105,102,
+10,10,35,105,102,32,100,101,102,105,110,101,100,40,65,82,77,95,77,65,84,72,95,78,69,79,78,95,79,86,69,82,82,73,68,69,41,10,35,100,101,102,105,110,101,32,97,114,109,95,97,100,100,
+95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,97,100,100,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,114,109,95,115,117,98,95,
+102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,115,117,98,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,114,109,95,109,117,108,116,
+95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,109,117,108,116,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,114,109,95,115,99,97,
+108,101,95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,115,99,97,108,101,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,114,109,95,111,
+102,102,115,101,116,95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,111,102,102,115,101,116,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,
+114,109,95,100,111,116,95,112,114,111,100,95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,100,111,116,95,112,114,111,100,95,102,51,50,95,110,101,111,110,10,35,100,101,
+102,105,110,101,32,97,114,109,95,97,100,100,95,113,49,53,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,97,100,100,95,113,49,53,95,110,101,111,110,10,35,100,101,102,
+105,110,101,32,97,114,109,95,115,117,98,95,113,49,53,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,115,117,98,95,113,49,53,95,110,101,111,110,10,35,100,101,102,105,
+110,101,32,97,114,109,95,109,117,108,116,95,113,49,53,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,109,117,108,116,95,113,49,53,95,110,101,111,110,10,35,100,101,102,
+105,110,101,32,97,114,109,95,115,99,97,108,101,95,113,49,53,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,115,99,97,108,101,95,113,49,53,95,110,101,111,110,10,35,100,101,
+102,105,110,101,32,97,114,109,95,102,105,114,95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,102,105,114,95,102,51,50,95,110,101,111,110,10,35,100,101,
+102,105,110,101,32,97,114,109,95,98,105,113,117,97,100,95,99,97,115,99,97,100,101,95,100,102,49,95,102,51,50,32,97,114,109,95,98,105,113,117,97,100,95,99,97,115,99,97,100,101,95,
+100,102,49,95,102,51,50,95,110,101,111,110,10,35,100,101,102,105,110,101,32,97,114,109,95,99,102,102,116,95,102,51,50,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,109,95,99,
+102,102,116,95,102,51,50,95,110,101,111,110,10,35,101,110,100,105,102,10,0,0};
+
+const char* arm_math_neon_RPI4B::arm_math_neon_h = (const char*) temp0;
@@ -0,0 +1,14 @@
+/* =========================================================================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#pragma once
+
+namespace arm_math_neon_RPI4B
+{
+    extern const char*   arm_math_neon_h;
+    const int            arm_math_neon_hSize = 13375;
+
+}
@@ -0,0 +1,32 @@
+// Host test that the arm_math_neon header embedded for the RPI4B includes zip matches
+// Libraries/arm_math_neon/arm_math_neon.h. Regenerate Resources/bsp/arm_math_neon_RPI4B.* when it fails.
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "Resources/bsp/arm_math_neon_RPI4B.h"
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        printf("usage: %s <path to arm_math_neon.h>\n", argv[0]);
+        return 2;
+    }
+    std::ifstream headerFile(argv[1], std::ios::binary);
+    if (!headerFile) {
+        printf("ArmMathNeonResourceTest: unable to open %s\n", argv[1]);
+        return 1;
+    }
+    std::string header((std::istreambuf_iterator<char>(headerFile)), std::istreambuf_iterator<char>());
+
+    if ((header.size() != static_cast<size_t>(arm_math_neon_RPI4B::arm_math_neon_hSize)) ||
+        (std::memcmp(header.data(), arm_math_neon_RPI4B::arm_math_neon_h, header.size()) != 0)) {
+        printf("FAIL: Resources/bsp/arm_math_neon_RPI4B.cpp is out of date with %s\n", argv[1]);
+        printf("ArmMathNeonResourceTest: 1 failure(s)\n");
+        return 1;
+    }
+    printf("ArmMathNeonResourceTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Host test for the build output parser. The lines are taken from real aarch64-none-elf GCC, binutils and
+// GNU make output, including progress lines that must not be reported as errors.
+#include <cstdio>
+#include <string>
+
+#include "Util/CommonDefs.h"
+#include "Build/LaunchProcessStream.h"
+
+using namespace stride;
+
+static unsigned g_failures = 0;
+
+static void check(bool condition, const std::string& description)
+{
+    if (!condition) {
+        printf("FAIL: %s\n", description.c_str());
+        g_failures++;
+    }
+}
+
+struct ParseCase {
+    const char* line;
+    bool isDiagnostic;
+    DiagnosticSeverity severity;
+    const char* tool;
+    const char* file;
+    int lineNumber;
+    int column;
+    const char* message;
+};
+
+static const DiagnosticSeverity NOTE    = DiagnosticSeverity::DIAG_NOTE;
+static const DiagnosticSeverity WARNING = DiagnosticSeverity::DIAG_WARNING;
+static const DiagnosticSeverity ERROR   = DiagnosticSeverity::DIAG_ERROR;
+
+static const ParseCase PARSE_CASES[] = {
+    // compiler diagnostics with a source location
+    { "src/Effect.cpp:42:17: error: 'gainDb' was not declared in this scope",
+      true, ERROR, "", "src/Effect.cpp", 42, 17, "'gainDb' was not declared in this scope" },
+    { "src/Effect.cpp:88:5: warning: unused variable 'x' [-Wunused-variable]",
+      true, WARNING, "", "src/Effect.cpp", 88, 5, "unused variable 'x' [-Wunused-variable]" },
+    { "src/Effect.h:12:7: note: candidate: 'void Effect::update()'",
+      true, NOTE, "", "src/Effect.h", 12, 7, "candidate: 'void Effect::update()'" },
+    { "src/Effect.cpp:3:10: fatal error: Avalon.h: No such file or directory",
+      true, ERROR, "", "src/Effect.cpp", 3, 10, "Avalon.h: No such file or directory" },
+    { "src/boot.S:17: Error: unknown mnemonic `mvo' -- `mvo x0,#1'",
+      true, ERROR, "", "src/boot.S", 17, 0, "unknown mnemonic `mvo' -- `mvo x0,#1'" },
+    { "src/boot.S:21: Warning: ignoring changed section attributes for .text",
+      true, WARNING, "", "src/boot.S", 21, 0, "ignoring changed section attributes for .text" },
+    { "C:\\Users\\dev\\efx\\src\\Effect.cpp:7:1: error: expected ';' before '}' token",
+      true, ERROR, "", "C:\\Users\\dev\\efx\\src\\Effect.cpp", 7, 1, "expected ';' before '}' token" },
+    { "src/Effect.cpp:99999999999:3: error: line number too long for an int",
+      true, ERROR, "", "src/Effect.cpp", 0, 3, "line number too long for an int" },
+    { "src/Effect.cpp:12: warning: no column",
+      true, WARNING, "", "src/Effect.cpp", 12, 0, "no column" },
+
+    // tool diagnostics with a severity marker
+    { "collect2: error: ld returned 1 exit status",
+      true, ERROR, "collect2", "", 0, 0, "ld returned 1 exit status" },
+    { "aarch64-none-elf-g++: fatal error: no input files",
+      true, ERROR, "aarch64-none-elf-g++", "", 0, 0, "no input files" },
+    { "aarch64-none-elf-ld: warning: obj/effect.o: missing .note.GNU-stack section implies executable stack",
+      true, WARNING, "aarch64-none-elf-ld", "", 0, 0, "obj/effect.o: missing .note.GNU-stack section implies executable stack" },
+    { "obj/effect.o: warning: relocation in read-only section `.text'",
+      true, WARNING, "", "obj/effect.o", 0, 0, "relocation in read-only section `.text'" },
+
+    // tool lines without a severity marker, only the fatal forms are errors
+    { "aarch64-none-elf-ld: cannot find -lcircle: No such file or directory",
+      true, ERROR, "aarch64-none-elf-ld", "", 0, 0, "cannot find -lcircle: No such file or directory" },
+    { "aarch64-none-elf-ld: section .text LMA [0000000000080000,00000000000a1fff] overlaps section .init LMA [0000000000080000,000000000008003f]",
+      true, ERROR, "aarch64-none-elf-ld", "", 0, 0, "section .text LMA [0000000000080000,00000000000a1fff] overlaps section .init LMA [0000000000080000,000000000008003f]" },
+    { "aarch64-none-elf-ld: region `RAM' overflowed by 2048 bytes",
+      true, ERROR, "aarch64-none-elf-ld", "", 0, 0, "region `RAM' overflowed by 2048 bytes" },
+    { "aarch64-none-elf-ld: obj/effect.o: in function `Effect::update()':",
+      true, NOTE, "aarch64-none-elf-ld", "", 0, 0, "obj/effect.o: in function `Effect::update()':" },
+    { "aarch64-none-elf-gcc-ar: creating obj/x.dat",
+      true, NOTE, "aarch64-none-elf-gcc-ar", "", 0, 0, "creating obj/x.dat" },
+    { "aarch64-none-elf-ar: obj/missing.o: No such file or directory",
+      true, ERROR, "aarch64-none-elf-ar", "", 0, 0, "obj/missing.o: No such file or directory" },
+    { "C:/stride/tools/bin/aarch64-none-elf-ld.exe: cannot open linker script file circle.ld: No such file or directory",
+      true, ERROR, "C:/stride/tools/bin/aarch64-none-elf-ld.exe", "", 0, 0, "cannot open linker script file circle.ld: No such file or directory" },
+
+    // linker errors with a section location
+    { "obj/effect.o:(.text._ZN6Effect6updateEv+0x1c): undefined reference to `arm_fir_f32'",
+      true, ERROR, "", "obj/effect.o", 0, 0, "undefined reference to `arm_fir_f32'" },
+    { "obj/b.o:(.bss.g_gain+0x0): multiple definition of `g_gain'; obj/a.o:(.bss.g_gain+0x0): first defined here",
+      true, ERROR, "", "obj/b.o", 0, 0, "multiple definition of `g_gain'; obj/a.o:(.bss.g_gain+0x0): first defined here" },
+
+    // make
+    { "make: *** [Makefile:57: obj/effect.o] Error 1",
+      true, ERROR, "make", "", 0, 0, "[Makefile:57: obj/effect.o] Error 1" },
+    { "make[2]: *** [../../Rules.mk:32: kernel8.elf] Error 1",
+      true, ERROR, "make[2]", "", 0, 0, "[../../Rules.mk:32: kernel8.elf] Error 1" },
+    { "mingw32-make.exe: *** No rule to make target 'all'.  Stop.",
+      true, ERROR, "mingw32-make.exe", "", 0, 0, "No rule to make target 'all'.  Stop." },
+    { "make: *** No rule to make target 'src/missing.cpp', needed by 'obj/missing.o'.  Stop.",
+      true, ERROR, "make", "", 0, 0, "No rule to make target 'src/missing.cpp', needed by 'obj/missing.o'.  Stop." },
+    { "make[1]: Entering directory '/home/dev/efx/build'",
+      false, NOTE, "", "", 0, 0, "" },
+
+    // progress lines
+    { "aarch64-none-elf-g++ -O3 -ffunction-sections -c src/Effect.cpp -o obj/effect.o",
+      false, NOTE, "", "", 0, 0, "" },
+    { "  CPP   src/Effect.cpp",
+      false, NOTE, "", "", 0, 0, "" },
+    { "",
+      false, NOTE, "", "", 0, 0, "" },
+};
+
+static void testParseCases()
+{
+    for (auto& parseCase : PARSE_CASES) {
+        BuildDiagnostic diagnostic;
+        std::string line = parseCase.line;
+        bool isDiagnostic = parseBuildDiagnostic(line, diagnostic);
+        check(isDiagnostic == parseCase.isDiagnostic, "diagnostic detected: " + line);
+        if (!isDiagnostic || !parseCase.isDiagnostic) { continue; }
+
+        check(diagnostic.severity == parseCase.severity, "severity: " + line);
+        check(diagnostic.tool == parseCase.tool, "tool '" + diagnostic.tool + "': " + line);
+        check(diagnostic.file == parseCase.file, "file '" + diagnostic.file + "': " + line);
+        check(diagnostic.line == parseCase.lineNumber, "line " + std::to_string(diagnostic.line) + ": " + line);
+        check(diagnostic.column == parseCase.column, "column " + std::to_string(diagnostic.column) + ": " + line);
+        check(diagnostic.message == parseCase.message, "message '" + diagnostic.message + "': " + line);
+    }
+}
+
+// A full compiler command line can run to megabytes, the parser must not recurse per character
+static void testLongLines()
+{
+    std::string commandLine = "aarch64-none-elf-g++";
+    while (commandLine.size() < (2u << 20)) { commandLine += " -I/home/dev/efx/include"; }
+    BuildDiagnostic diagnostic;
+    check(!parseBuildDiagnostic(commandLine, diagnostic), "long command line is not a diagnostic");
+
+    std::string longError = "src/Effect.cpp:1:1: error: " + std::string(2u << 20, 'x');
+    check(parseBuildDiagnostic(longError, diagnostic) && (diagnostic.severity == ERROR) &&
+        (diagnostic.message.size() == (2u << 20)), "long error message");
+}
+
+int main()
+{
+    testParseCases();
+    testLongLines();
+
+    if (g_failures) {
+        printf("LaunchProcessStreamTest: %u failure(s)\n", g_failures);
+        return 1;
+    }
+    printf("LaunchProcessStreamTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,284 @@
+// Host test for the hot-load module linker. The fixture is a real ld -r style object assembled from
+// Tests/fixtures/hotload_module.s, it covers the GOT, CALL26 veneer, ADRP/LO12, JUMP26 and ABS64 relocations
+// and the init/fini arrays.
+// Regenerate kHotloadModule with:
+//   llvm-mc -triple=aarch64-none-elf -filetype=obj Tests/fixtures/hotload_module.s -o hotload_module.o
+//   xxd -i hotload_module.o
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Util/CommonDefs.h"
+#include "Build/RelocatableModule.h"
+
+using namespace platform;
+
+static const uint8_t kHotloadModule[] = {
+    0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0xb7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0c, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x90,
+    0x21, 0x00, 0x40, 0xf9, 0x00, 0x00, 0x00, 0x14, 0xc0, 0x03, 0x5f, 0xd6, 0xc0, 0x03, 0x5f, 0xd6,
+    0xc0, 0x03, 0x5f, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x37, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x00, 0x2e, 0x72,
+    0x65, 0x6c, 0x61, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x2e,
+    0x72, 0x65, 0x6c, 0x61, 0x2e, 0x66, 0x69, 0x6e, 0x69, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00,
+    0x2e, 0x72, 0x65, 0x6c, 0x61, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+    0x65, 0x5f, 0x65, 0x78, 0x69, 0x74, 0x00, 0x2e, 0x62, 0x73, 0x73, 0x00, 0x63, 0x6f, 0x72, 0x65,
+    0x5f, 0x76, 0x61, 0x72, 0x00, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00,
+    0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x63, 0x6f, 0x72, 0x65, 0x5f,
+    0x66, 0x75, 0x6e, 0x63, 0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x79,
+    0x6d, 0x74, 0x61, 0x62, 0x00, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x5f, 0x64, 0x61, 0x74, 0x61,
+    0x00, 0x2e, 0x72, 0x65, 0x6c, 0x61, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x00, 0x24, 0x64, 0x2e, 0x34,
+    0x00, 0x24, 0x64, 0x2e, 0x33, 0x00, 0x24, 0x64, 0x2e, 0x32, 0x00, 0x24, 0x64, 0x2e, 0x31, 0x00,
+    0x24, 0x78, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint64_t LOAD_ADDRESS   = 0x10000000;
+static const uint64_t CORE_FUNC_ADDR = 0x80100;
+static const uint64_t CORE_VAR_ADDR  = 0x90000;
+
+static unsigned g_failures = 0;
+
+static void check(bool condition, const std::string& description)
+{
+    if (!condition) {
+        printf("FAIL: %s\n", description.c_str());
+        g_failures++;
+    }
+}
+
+static uint32_t read32(const std::vector<uint8_t>& image, uint64_t address)
+{
+    uint32_t value = 0;
+    uint64_t offset = address - LOAD_ADDRESS;
+    if (offset + sizeof(value) <= image.size()) { memcpy(&value, &image[offset], sizeof(value)); }
+    return value;
+}
+
+static uint64_t read64(const std::vector<uint8_t>& image, uint64_t address)
+{
+    uint64_t value = 0;
+    uint64_t offset = address - LOAD_ADDRESS;
+    if (offset + sizeof(value) <= image.size()) { memcpy(&value, &image[offset], sizeof(value)); }
+    return value;
+}
+
+static int64_t signExtend(uint64_t value, unsigned bits)
+{
+    uint64_t signBit = 1ULL << (bits - 1);
+    return static_cast<int64_t>((value ^ signBit) - signBit);
+}
+
+// Target page of an ADRP at pc
+static uint64_t decodeAdrp(uint32_t insn, uint64_t pc)
+{
+    uint64_t imm = (((insn >> 5) & 0x7ffff) << 2) | ((insn >> 29) & 0x3);
+    return (pc & ~0xfffULL) + (signExtend(imm, 21) << 12);
+}
+
+// Target of a B or BL at pc
+static uint64_t decodeBranch(uint32_t insn, uint64_t pc)
+{
+    return pc + (signExtend(insn & 0x3ffffff, 26) << 2);
+}
+
+static void writeField(std::vector<uint8_t>& data, uint64_t offset, uint64_t value)
+{
+    for (unsigned i = 0; i < 8; i++) { data[offset + i] = static_cast<uint8_t>(value >> (8 * i)); }
+}
+
+static std::vector<uint8_t> getFixture()
+{
+    return std::vector<uint8_t>(kHotloadModule, kHotloadModule + sizeof(kHotloadModule));
+}
+
+static void testLink()
+{
+    // Exercise the nm parser the same way uploadModule() does
+    const std::string symbolFilePath = "RelocatableModuleTest.syms";
+    {
+        std::ofstream symbolFile(symbolFilePath);
+        symbolFile << "0000000000080100 T core_func\n";
+        symbolFile << "0000000000090000 B core_var\n";
+    }
+
+    RelocatableModule module;
+    check(module.loadSymbolTable(symbolFilePath) == SUCCESS, "loadSymbolTable()");
+    std::remove(symbolFilePath.c_str());
+    check(module.loadModule(getFixture()) == SUCCESS, "loadModule()");
+    check(module.link(LOAD_ADDRESS) == SUCCESS, "link()");
+    check(module.getUnresolvedSymbols().empty(), "no unresolved symbols");
+
+    const std::vector<uint8_t>& image = module.getImage();
+    uint64_t entry = 0, localFunc = 0, moduleData = 0;
+    check(module.getSymbolAddress("module_entry", entry) && (entry == LOAD_ADDRESS), "module_entry at the load address");
+    check(module.getSymbolAddress("local_func", localFunc) && (localFunc == entry + 0x1c), "local_func address");
+    check(module.getSymbolAddress("module_data", moduleData), "module_data address");
+
+    // adrp x0, data_value / add x0, x0, :lo12:data_value (section symbol .data + 8)
+    uint64_t dataValue = decodeAdrp(read32(image, entry), entry) + ((read32(image, entry + 4) >> 10) & 0xfff);
+    check(dataValue == moduleData + 8, "ADR_PREL_PG_HI21 / ADD_ABS_LO12_NC");
+
+    // bl core_func is out of range of the module, so it goes through a veneer
+    uint64_t veneer = decodeBranch(read32(image, entry + 8), entry + 8);
+    check(read32(image, veneer) == 0x58000050, "veneer ldr x16, #8");
+    check(read32(image, veneer + 4) == 0xd61f0200, "veneer br x16");
+    check(read64(image, veneer + 8) == CORE_FUNC_ADDR, "veneer target is core_func");
+
+    // adrp x1, :got:core_var / ldr x1, [x1, :got_lo12:core_var]
+    uint64_t gotEntry = decodeAdrp(read32(image, entry + 12), entry + 12) + (((read32(image, entry + 16) >> 10) & 0xfff) << 3);
+    check(read64(image, gotEntry) == CORE_VAR_ADDR, "ADR_GOT_PAGE / LD64_GOT_LO12_NC");
+
+    // b local_func
+    check(decodeBranch(read32(image, entry + 20), entry + 20) == localFunc, "JUMP26");
+
+    // .xword core_var + 4
+    check(read64(image, moduleData) == CORE_VAR_ADDR + 4, "ABS64 with addend");
+
+    std::vector<uint64_t> initFunctions = module.getInitFunctions();
+    check((initFunctions.size() == 1) && (initFunctions[0] == localFunc), "init_array");
+
+    // .fini_array holds module_exit, local_func and runs last to first
+    uint64_t moduleExit = 0;
+    check(module.getSymbolAddress("module_exit", moduleExit) && (moduleExit == localFunc + 4), "module_exit address");
+    std::vector<uint64_t> finiFunctions = module.getFiniFunctions();
+    check((finiFunctions.size() == 2) && (finiFunctions[0] == localFunc) && (finiFunctions[1] == moduleExit), "fini_array in reverse order");
+}
+
+static void testUnresolved()
+{
+    RelocatableModule module;
+    module.addCoreSymbol("core_func", CORE_FUNC_ADDR);
+    check(module.loadModule(getFixture()) == SUCCESS, "loadModule()");
+    check(module.link(LOAD_ADDRESS) != SUCCESS, "link() fails with a missing core symbol");
+    const std::vector<std::string>& unresolved = module.getUnresolvedSymbols();
+    check((unresolved.size() == 1) && (unresolved[0] == "core_var"), "core_var reported unresolved once");
+}
+
+static void testRejectsBadInput()
+{
+    RelocatableModule module;
+    std::vector<uint8_t> truncated = getFixture();
+    truncated.resize(32);
+    check(module.loadModule(truncated) != SUCCESS, "truncated module rejected");
+
+    std::vector<uint8_t> wrongMachine = getFixture();
+    wrongMachine[18] = 62; // EM_X86_64
+    check(module.loadModule(wrongMachine) != SUCCESS, "non-AArch64 module rejected");
+
+    // offsets near 2^64 must not wrap around the bounds checks
+    std::vector<uint8_t> wrappedHeaders = getFixture();
+    writeField(wrappedHeaders, 40, 0xffffffffffffffc0ULL); // e_shoff
+    check(module.loadModule(wrappedHeaders) != SUCCESS, "section header offset that wraps rejected");
+
+    std::vector<uint8_t> wrappedSection = getFixture();
+    uint64_t shoff = 0;
+    for (unsigned i = 0; i < 8; i++) { shoff |= static_cast<uint64_t>(wrappedSection[40 + i]) << (8 * i); }
+    writeField(wrappedSection, shoff + 2 * 64 + 24, 0xfffffffffffffff8ULL); // .text sh_offset
+    check(module.loadModule(wrappedSection) != SUCCESS, "section offset that wraps rejected");
+}
+
+int main()
+{
+    testLink();
+    testUnresolved();
+    testRejectsBadInput();
+
+    if (g_failures) {
+        printf("RelocatableModuleTest: %u failure(s)\n", g_failures);
+        return 1;
+    }
+    printf("RelocatableModuleTest: passed\n");
+    return 0;
+}
@@ -0,0 +1,38 @@
+    .text
+    .globl  module_entry
+    .globl  local_func
+    .globl  module_exit
+    .p2align 2
+module_entry:
+    adrp    x0, data_value
+    add     x0, x0, :lo12:data_value
+    bl      core_func
+    adrp    x1, :got:core_var
+    ldr     x1, [x1, :got_lo12:core_var]
+    b       local_func
+    ret
+local_func:
+    ret
+module_exit:
+    ret
+
+    .data
+    .globl  module_data
+    .p2align 3
+module_data:
+    .xword  core_var + 4
+data_value:
+    .xword  0
+
+    .section .init_array,"aw",%init_array
+    .p2align 3
+    .xword  local_func
+
+    .section .fini_array,"aw",%fini_array
+    .p2align 3
+    .xword  module_exit
+    .xword  local_func
+
+    .bss
+    .p2align 4
+    .zero   64
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <string>
+
+namespace stride {
+int LaunchProcessCommand(const std::string& command, std::string& result, const std::string& workingDirectory,
+    unsigned timeoutSeconds = 0);
+}
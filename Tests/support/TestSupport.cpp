@@ -0,0 +1,26 @@
+// Message sinks for the host tests. Errors are printed so an unexpected failure shows its reason,
+// notes are dropped to keep the test output to the results.
+#include <cstdio>
+
+#include "Util/CommonDefs.h"
+#include "Util/ErrorMessage.h"
+#include "Build/LaunchProcess.h"
+
+namespace stride {
+
+void errorMessage(const std::string& message)
+{
+    fprintf(stderr, "error: %s\n", message.c_str());
+}
+
+void noteMessage(const std::string&)
+{
+}
+
+// Only the Windows build of LaunchProcessStreaming() uses this, the tests run on Linux and macOS
+int LaunchProcessCommand(const std::string&, std::string&, const std::string&, unsigned)
+{
+    return FAILURE;
+}
+
+}
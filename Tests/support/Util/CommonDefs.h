@@ -0,0 +1,12 @@
+#pragma once
+
+// The parts of the editor's Util/CommonDefs.h the host tests use, so they build without the editor tree.
+// Build with STRIDE_INCLUDE=<path> to use the real headers instead.
+
+namespace stride {
+constexpr int SUCCESS = 0;
+constexpr int FAILURE = -1;
+}
+
+using stride::SUCCESS;
+using stride::FAILURE;
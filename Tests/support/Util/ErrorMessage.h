@@ -0,0 +1,8 @@
+#pragma once
+
+#include <string>
+
+namespace stride {
+void errorMessage(const std::string& message);
+void noteMessage(const std::string& message);
+}